@@ -125,6 +125,27 @@ public:
    */
   void setRecomputeMarkersFlag(const bool flag){ _recompute_markers_during_cycles = flag; }
 
+  /**
+   * Set whether stateful material properties are projected onto refined and coarsened elements with a
+   * least squares (L2) fit instead of copying the value of the nearest quadrature point
+   */
+  void setL2StatefulProjection(bool state = true) { _l2_stateful_projection = state; }
+
+  /**
+   * @return whether stateful material properties are projected with a least squares fit
+   */
+  bool l2StatefulProjection() const { return _l2_stateful_projection; }
+
+  /**
+   * Set whether the time spent in each adaptivity cycle is printed
+   */
+  void setPrintTiming(bool state = true) { _print_timing = state; }
+
+  /**
+   * @return whether the time spent in each adaptivity cycle is printed
+   */
+  bool printTiming() const { return _print_timing; }
+
   /**
    * Adapts the mesh based on the error estimator used
    *
@@ -280,6 +301,12 @@ protected:
   /// Whether or not to recompute markers during adaptivity cycles
   bool _recompute_markers_during_cycles;
 
+  /// Whether stateful material properties are projected with a least squares fit
+  bool _l2_stateful_projection;
+
+  /// Whether the time spent in each adaptivity cycle is printed
+  bool _print_timing;
+
   /// Stores pointers to ErrorVectors associated with indicator field names
   std::map<std::string, ErrorVector *> _indicator_field_to_error_vector;
 };
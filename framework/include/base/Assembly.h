@@ -338,6 +338,48 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Set the maximum amount of memory (in bytes) the FE shape function cache may use.  Once
+   * the limit is reached no new entries are added, elements that miss are simply recomputed.
+   * Zero means no limit.
+   */
+  void setFECacheMemoryLimit(std::size_t max_bytes) { _fe_cache_memory_limit = max_bytes; }
+
+  /// Number of volume reinits served from the FE shape function cache
+  unsigned long int feCacheHits() const { return _fe_cache_hits; }
+
+  /// Number of volume reinits that had to be computed while the FE shape function cache was on
+  unsigned long int feCacheMisses() const { return _fe_cache_misses; }
+
+  /// Number of distinct element shapes stored in the FE shape function cache
+  std::size_t feCacheEntries() const { return _fe_shape_data_cache.size(); }
+
+  /// Approximate memory (in bytes) held by the FE shape function cache
+  std::size_t feCacheMemory() const { return _fe_cache_memory; }
+
+  /**
+   * Restrict the volume FE reinit to the given FE types (the FE types of the variables that are
+   * active on the current subdomain).  The FE objects of all other types are left alone by
+   * reinit(elem) until clearActiveFETypes() is called.
+   */
+  void setActiveFETypes(const std::set<FEType> & fe_types);
+
+  /// Go back to reinitializing the volume FE objects of every FE type
+  void clearActiveFETypes();
+
+  /**
+   * Add the FE types of the coupled variables active on subdomain to the active FE types.  The
+   * Jacobian loops prepare the shape functions of every coupled variable, including the ones
+   * no object on the subdomain depends on.
+   */
+  void addCoupledFETypes(SubdomainID subdomain);
+
+  /// Number of volume FE objects reinitialized
+  unsigned long int feReinits() const { return _fe_reinits; }
+
+  /// Number of volume FE object reinits skipped because their FE type was not active
+  unsigned long int feReinitsSkipped() const { return _fe_reinits_skipped; }
+
   void prepare();
 
   /**
@@ -417,6 +459,26 @@ public:
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Multiplies the blocks that are currently in _sub_Kee by the entries of v (which must be
+   * ghosted) and appends the products to the cached Jacobian action values.  This is the
+   * matrix-free counterpart of cacheJacobian(): the blocks are zeroed and never stored.
+   */
+  void cacheJacobianAction(const NumericVector<Number> & v);
+
+  /**
+   * Same as cacheJacobianAction() for the neighbor Dense Matrices.
+   */
+  void cacheJacobianNeighborAction(const NumericVector<Number> & v);
+
+  /**
+   * Adds the values that have been cached by calling cacheJacobianAction() and or
+   * cacheJacobianNeighborAction() to y.
+   *
+   * Note that this will also clear the cache.
+   */
+  void addCachedJacobianAction(NumericVector<Number> & y);
+
   DenseVector<Number> & residualBlock(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Re[static_cast<unsigned int>(type)][var_num]; }
   DenseVector<Number> & residualBlockNeighbor(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Rn[static_cast<unsigned int>(type)][var_num]; }
 
@@ -424,7 +486,21 @@ public:
   DenseMatrix<Number> & jacobianBlockNeighbor(Moose::DGJacobianType type, unsigned int ivar, unsigned int jvar);
   void cacheJacobianBlock(DenseMatrix<Number> & jac_block, std::vector<dof_id_type> & idof_indices, std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
 
-  std::vector<std::pair<MooseVariable *, MooseVariable *> > & couplingEntries() { return _cm_entry; }
+  std::vector<std::pair<MooseVariable *, MooseVariable *> > & couplingEntries() { return _jacobian_action ? _cm_full_entry : _cm_entry; }
+
+  /**
+   * Builds the list of all pairs of field variables and makes room for all of their element
+   * Jacobian blocks, as needed by the matrix-free Jacobian action.  The coupling matrix, and with
+   * it the sparsity of the stored preconditioning matrix, is left alone.
+   */
+  void initJacobianAction();
+
+  /**
+   * While set, couplingEntries() returns every pair of field variables instead of the entries of
+   * the coupling matrix, so the matrix-free operator applies the full Jacobian no matter how
+   * sparse the preconditioner is.  initJacobianAction() must have been called.
+   */
+  void setJacobianActionMode(bool jacobian_action) { _jacobian_action = jacobian_action; }
 
   const VariablePhiValue & phi() { return _phi; }
   const VariablePhiGradient & gradPhi() { return _grad_phi; }
@@ -460,6 +536,7 @@ public:
 
   /**
    * Invalidate any currently cached data.  In particular this will cause FE data to get recached.
+   * The hit and miss counters are kept.
    */
   void invalidateCache();
 
@@ -485,6 +562,13 @@ public:
    */
   void addCachedJacobianContributions(SparseMatrix<Number> & jacobian);
 
+  /**
+   * The matrix-free counterpart of setCachedJacobianContributions(): each cached row of y is
+   * replaced by the product of the cached entries of that row with v (which must be ghosted).
+   * y must be closed before this is called.
+   */
+  void setCachedJacobianContributionsAction(const NumericVector<Number> & v, NumericVector<Number> & y);
+
   /**
    * Set the pointer to the XFEM controller object
    */
@@ -498,6 +582,22 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Build the key used to look up elem in the FE shape function cache.  Elements that are
+   * translations of one another (same type, p level and quadrature rule, and the same node
+   * positions relative to their first node) get the same key.
+   */
+  void feCacheKey(const Elem * elem, std::vector<Real> & key) const;
+
+  /// Free all of the entries in the FE shape function cache
+  void clearFECache();
+
+  /// Whether the volume FE objects of type fe_type have to be reinitialized
+  bool needFEReinit(const FEType & fe_type) const
+  {
+    return !_restrict_fe_types || _active_fe_types.find(fe_type) != _active_fe_types.end();
+  }
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -521,6 +621,8 @@ protected:
 
   void addJacobianBlock(SparseMatrix<Number> & jacobian, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
 
+  void cacheJacobianBlockAction(DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor, const NumericVector<Number> & v);
+
 
   /**
    * Clear any currently cached jacobian contributions
@@ -541,6 +643,10 @@ protected:
   CouplingMatrix * & _cm;
   /// Entries in the coupling matrix (only for field variables)
   std::vector<std::pair<MooseVariable *, MooseVariable *> > _cm_entry;
+  /// All pairs of field variables, used instead of _cm_entry by the matrix-free Jacobian action
+  std::vector<std::pair<MooseVariable *, MooseVariable *> > _cm_full_entry;
+  /// Whether the matrix-free Jacobian action is being computed (see setJacobianActionMode())
+  bool _jacobian_action;
   /// Flag that indicates if the jacobian block was used
   std::vector<std::vector<unsigned char> > _jacobian_block_used;
   /// Flag that indicates if the jacobian block for neighbor was used
@@ -686,6 +792,8 @@ protected:
 
   /// auxiliary matrix for scaling jacobians (optimization to avoid expensive construction/destruction)
   DenseMatrix<Number> _tmp_Ke;
+  /// auxiliary vector holding the entries of the vector a block is applied to
+  std::vector<Number> _tmp_vj;
 
   // Shape function values, gradients. second derivatives
   VariablePhiValue _phi;
@@ -713,10 +821,13 @@ protected:
   };
 
   /**
-   * Ok - here's the design.  One ElementFEShapeData class will be stored per element in _fe_shape_data_cache.
-   * When reinit() is called on an element we will retrieve the ElementFEShapeData class associated with that
-   * element.  If it's NULL we'll make one.  Then we'll store a copy of the shape functions computed on that
-   * element within shape_data and JxW and q_points within ElementFEShapeData.
+   * Ok - here's the design.  Shape functions, their derivatives and JxW only depend on the shape of an
+   * element, not on where it sits in space.  So one ElementFEShapeData class is stored per distinct
+   * element shape (see feCacheKey()) in _fe_shape_data_cache.  When reinit() is called on an element we
+   * look up its shape.  If it's not there we compute the FE data and store a copy of the shape functions
+   * within shape_data and JxW and q_points within ElementFEShapeData.  If it is there the cached values are
+   * used and the quadrature points are shifted by the offset between the element and the cached one.
+   * Meshes made of congruent elements (GeneratedMesh, TiledMesh, ...) need only a handful of entries.
    */
   class ElementFEShapeData
   {
@@ -724,18 +835,48 @@ protected:
     /// This is where the cached shape functions will be held
     std::map<FEType, FEShapeData *> _shape_data;
 
-    /// Whether or not this data is invalid (needs to be recached) note that there is no constructor so the value is invalid the first time through and must be set.
-    bool _invalidated;
-
     /// Cached JxW
     MooseArray<Real> _JxW;
 
     /// Cached xyz positions of quadrature points
     MooseArray<Point> _q_points;
+
+    /// Position of the first node of the element the data was computed on
+    Point _origin;
   };
 
-  /// Cached shape function values stored by element
-  std::map<dof_id_type, ElementFEShapeData * > _element_fe_shape_data_cache;
+  /// Cached shape function values stored by element shape
+  std::map<std::vector<Real>, ElementFEShapeData * > _fe_shape_data_cache;
+
+  /// Scratch space for the key of the element being looked up
+  std::vector<Real> _fe_cache_key;
+
+  /// Quadrature points of the current element when they come from the cache
+  MooseArray<Point> _fe_cache_q_points;
+
+  /// Maximum memory (in bytes) the cache may use, zero for no limit
+  std::size_t _fe_cache_memory_limit;
+
+  /// Approximate memory (in bytes) currently used by the cache
+  std::size_t _fe_cache_memory;
+
+  /// Number of reinits served from the cache
+  unsigned long int _fe_cache_hits;
+
+  /// Number of reinits computed while caching
+  unsigned long int _fe_cache_misses;
+
+  /// Whether the volume FE reinit is restricted to _active_fe_types
+  bool _restrict_fe_types;
+
+  /// FE types reinitialized by reinit(elem) while _restrict_fe_types is set
+  std::set<FEType> _active_fe_types;
+
+  /// Number of volume FE objects reinitialized
+  unsigned long int _fe_reinits;
+
+  /// Number of volume FE object reinits skipped
+  unsigned long int _fe_reinits_skipped;
 
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
@@ -766,6 +907,11 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// Values cached by calling cacheJacobianAction()
+  std::vector<Real> _cached_jacobian_action_values;
+  /// Row where the corresponding cached value should go
+  std::vector<dof_id_type> _cached_jacobian_action_rows;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
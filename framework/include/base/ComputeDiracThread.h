@@ -22,6 +22,10 @@
 // libMesh includes
 #include "libmesh/elem_range.h"
 
+// System includes
+#include <map>
+#include <vector>
+
 // Forward declarations
 class NonlinearSystem;
 class DiracKernel;
@@ -53,6 +57,9 @@ protected:
 
   /// Storage for DiracKernel objects
   const MooseObjectWarehouse<DiracKernel> & _dirac_kernels;
+
+  /// The DiracKernels that have points on each element, by element id, built in pre()
+  std::map<dof_id_type, std::vector<DiracKernel *> > _dirac_kernels_on_elem;
 };
 
 #endif //COMPUTEDIRACTHREAD_H
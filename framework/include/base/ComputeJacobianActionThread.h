@@ -0,0 +1,57 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// Forward declarations
+class FEProblem;
+class NonlinearSystem;
+
+/**
+ * Computes y = J v one element at a time.  The element Jacobians are computed exactly as
+ * they are for assembly, multiplied by the local entries of v and discarded, so the global
+ * matrix is never formed.
+ */
+class ComputeJacobianActionThread : public ComputeFullJacobianThread
+{
+public:
+  /**
+   * @param v The vector the Jacobian is applied to, it must be ghosted
+   * @param y The product, contributions are added to it
+   */
+  ComputeJacobianActionThread(FEProblem & fe_problem, NonlinearSystem & sys, const NumericVector<Number> & v, NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  void join(const ComputeJacobianThread & /*y*/)
+  {}
+
+protected:
+  virtual void postElement(const Elem * elem);
+  virtual void addJacobianNeighbor();
+
+  /// The vector the Jacobian is applied to
+  const NumericVector<Number> & _v;
+
+  /// The product
+  NumericVector<Number> & _y;
+};
+
+#endif //COMPUTEJACOBIANACTIONTHREAD_H
@@ -48,12 +48,21 @@ public:
 
   void join(const ComputeJacobianThread & /*y*/);
 
+  /**
+   * Add each element matrix to the Jacobian without taking the global lock.  Only valid
+   * when no two elements in the range share rows (see MooseMesh::getColoredElementRanges()).
+   */
+  void setLockFree(bool lock_free) { _lock_free = lock_free; }
+
 protected:
   SparseMatrix<Number> & _jacobian;
   NonlinearSystem & _sys;
 
   unsigned int _num_cached;
 
+  /// Whether element matrices are added without locking
+  bool _lock_free;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -70,6 +79,9 @@ protected:
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian(const Elem * neighbor);
   virtual void computeInternalInterFaceJacobian(BoundaryID bnd_id);
+
+  /// Adds the blocks computed on an internal side or interface to the Jacobian
+  virtual void addJacobianNeighbor();
 };
 
 #endif //COMPUTEJACOBIANTHREAD_H
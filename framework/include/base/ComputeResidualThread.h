@@ -50,10 +50,16 @@ public:
   void join(const ComputeResidualThread & /*y*/);
 
 protected:
+  /// Move the neighbor residual contributions into the per-thread cache or directly into the residual
+  void addResidualNeighbor();
+
   NonlinearSystem & _sys;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// When RA_THREAD_LOCAL the cached residuals are only added to the global vector after the loop
+  Moose::ResidualAssemblyType _residual_assembly;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
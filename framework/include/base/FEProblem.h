@@ -304,6 +304,13 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Limit the memory used by the FE shape function cache of each thread.
+   *
+   * @param max_megabytes The limit in megabytes, zero for no limit.
+   */
+  void setFECacheMemoryLimit(Real max_megabytes);
+
   virtual void init();
   virtual void solve();
 
@@ -673,6 +680,23 @@ public:
   virtual void computeResidualType(const NumericVector<Number> & soln, NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
   virtual void computeJacobian(NonlinearImplicitSystem & sys, const NumericVector<Number> & soln, SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Computes y = J v without forming J, by applying each element Jacobian as it is computed.
+   * J is linearized about the solution of the last residual or Jacobian evaluation.
+   *
+   * Used by solve_type = MATRIX_FREE
+   *
+   * @param v The vector the Jacobian is applied to
+   * @param y The product
+   */
+  virtual void computeJacobianAction(const NumericVector<Number> & v, NumericVector<Number> & y);
+
+  /**
+   * Prepares the Assembly objects for computeJacobianAction().  The action always applies every
+   * (ivar, jvar) block, the coupling matrix only controls the stored preconditioning matrix.
+   */
+  virtual void initJacobianAction();
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller preconditioning matrices.
    *
@@ -764,6 +788,10 @@ public:
   virtual void cacheJacobianNeighbor(THREAD_ID tid);
   virtual void addCachedJacobian(SparseMatrix<Number> & jacobian, THREAD_ID tid);
 
+  virtual void cacheJacobianAction(const NumericVector<Number> & v, THREAD_ID tid);
+  virtual void cacheJacobianNeighborAction(const NumericVector<Number> & v, THREAD_ID tid);
+  virtual void addCachedJacobianAction(NumericVector<Number> & y, THREAD_ID tid);
+
   virtual void prepareShapes(unsigned int var, THREAD_ID tid);
   virtual void prepareFaceShapes(unsigned int var, THREAD_ID tid);
   virtual void prepareNeighborShapes(unsigned int var, THREAD_ID tid);
@@ -1168,6 +1196,9 @@ protected:
   /// Whether nor not stateful materials have been initialized
   bool _has_initialized_stateful;
 
+  /// Wall time (in seconds) spent projecting stateful material properties during the last meshChanged()
+  Real _stateful_projection_time;
+
   /// Object responsible for restart (read/write)
   Resurrector * _resurrector;
 
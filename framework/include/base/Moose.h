@@ -50,6 +50,7 @@ class Factory;
 // forward declarations
 class Syntax;
 class FEProblem;
+class ObjectProfiler;
 
 
 namespace Moose
@@ -65,6 +66,11 @@ extern PerfLog perf_log;
  * PerfLog to be used during setup.  This log will get printed just before the first solve. */
 extern PerfLog setup_perf_log;
 
+/**
+ * Per-object timers, disabled unless a Profile output is used (see ObjectProfiler).
+ */
+extern ObjectProfiler object_profiler;
+
 /**
  * Variable indicating whether we will enable FPE trapping for this run.
  */
@@ -302,6 +302,20 @@ protected:
    */
   void getDofIndices(const Elem * elem, std::vector<dof_id_type> & dof_indices);
 
+  /**
+   * Shared implementation of computeElemValues(), computeElemValuesFace(), computeNeighborValues()
+   * and computeNeighborValuesFace().  The dof coefficients are gathered up front and every requested
+   * field is then computed with QpInterpolation::interpolate().
+   * @param nqp The number of quadrature points
+   * @param phi, grad_phi, second_phi The shape functions to use (second_phi may be NULL if not needed)
+   * @param neighbor Whether to fill in the neighbor values
+   */
+  void computeQpValues(unsigned int nqp,
+                       const VariablePhiValue & phi,
+                       const VariablePhiGradient & grad_phi,
+                       const VariablePhiSecond * second_phi,
+                       bool neighbor);
+
 protected:
   /// Thread ID
   THREAD_ID _tid;
@@ -446,6 +460,12 @@ protected:
   /// scaling factor for this variable
   Real _scaling_factor;
 
+  /// Scratch space for the dof coefficients used by computeQpValues()
+  std::vector<Real> _local_soln;
+  std::vector<Real> _local_soln_old;
+  std::vector<Real> _local_soln_older;
+  std::vector<Real> _local_u_dot;
+
   friend class NodeFaceConstraint;
   friend class ValueThresholdMarker;
   friend class ValueRangeMarker;
@@ -81,6 +81,20 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+
+  /**
+   * Hands PETSc a shell matrix as the Jacobian operator for solve_type = MATRIX_FREE.  Its
+   * products are computed by computeJacobianAction() with every variable coupled, while the
+   * system matrix is assembled as the preconditioning matrix with only the blocks of the
+   * coupling matrix (the diagonal blocks unless a [Preconditioning] block asks for more).
+   */
+  void setupMatrixFreeOperator();
+
+  /**
+   * Tells PETSc whether the first Newton step of the coming solve may reuse the last Jacobian
+   * when Executioner/reuse_jacobian is set.
+   */
+  void setupJacobianReuse();
   void setupDecomposition();
   void setupSplitBasedPreconditioner();
 
@@ -251,6 +265,13 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Computes y = J v without forming J
+   * @param v The vector the Jacobian is applied to
+   * @param y The product is formed in here
+   */
+  void computeJacobianAction(const NumericVector<Number> & v, NumericVector<Number> & y);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller preconditioning matrices.
    *
@@ -421,6 +442,48 @@ public:
 
   Moose::PCSideType getPCSide() { return _pc_side; }
 
+  /**
+   * Set/get how element residuals are moved into the global residual vector
+   */
+  void setResidualAssembly(MooseEnum residual_assembly);
+  Moose::ResidualAssemblyType getResidualAssembly() const { return _residual_assembly; }
+
+  /**
+   * Set/get how element Jacobians are moved into the global matrix
+   */
+  void setJacobianAssembly(MooseEnum jacobian_assembly);
+  Moose::JacobianAssemblyType getJacobianAssembly() const { return _jacobian_assembly; }
+
+  /**
+   * Turn on reuse of the Jacobian and preconditioner across Newton iterations and time steps.
+   * A new Jacobian is only computed when the number of linear iterations of a Newton step exceeds
+   * max_linear_its or when the ratio of two successive nonlinear residual norms exceeds max_contraction.
+   */
+  void setJacobianReuse(bool reuse, unsigned int max_linear_its, Real max_contraction);
+  bool reuseJacobian() const { return _reuse_jacobian; }
+
+  /**
+   * Make the next nonlinear iteration compute a new Jacobian, e.g. after the mesh has changed
+   */
+  void forceJacobianRebuild() { _force_jacobian_rebuild = true; }
+
+  /**
+   * Called by the nonlinear convergence check before each Newton step: decides whether the
+   * Jacobian of the previous step may be reused for the next one.
+   * @param it The current nonlinear iteration
+   * @param fnorm The current nonlinear residual norm
+   */
+  void updateJacobianReuse(unsigned int it, Real fnorm);
+
+  /**
+   * Statistics of the Jacobian reuse policy
+   */
+  unsigned int nJacobianEvaluations() const { return _n_jacobian_evaluations; }
+  unsigned int nJacobianReuses() const { return _n_jacobian_reuses; }
+  unsigned int nLinearIterationRebuilds() const { return _n_linear_its_rebuilds; }
+  unsigned int nContractionRebuilds() const { return _n_contraction_rebuilds; }
+  unsigned int nForcedRebuilds() const { return _n_forced_rebuilds; }
+
   /**
    * Indicated whether this system needs material properties on boundaries.
    * @return Boolean if IntegratedBCs are active
@@ -490,6 +553,35 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Computes the Jacobian rows of the NodalBCs, they are left cached in the thread 0 Assembly
+   * object to be set into a matrix (or applied to a vector) by the caller.
+   */
+  void computeNodalBCsJacobian();
+
+  /**
+   * Whether the element Jacobian loop can add element matrices to the global matrix color by
+   * color without locking.  This requires that element matrices only touch rows of the element's
+   * own nodes (no DG, interface kernels, scalar variables or constraints on the dofs).
+   */
+  bool canUseColoredJacobianAssembly();
+
+  /**
+   * Whether the colored element Jacobian loop can skip the lock.  Concurrent insertion into
+   * disjoint local rows is only safe if PETSc never reallocates the matrix, i.e. if
+   * "error_on_jacobian_nonzero_reallocation" is set and no entries are added outside of the
+   * preallocated sparsity pattern, if the matrix is stored in the AIJ format and if PETSc is not a
+   * debug build without thread safety (which keeps a global function stack).
+   */
+  bool canUseLockFreeJacobianAssembly(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Run the element Jacobian loop with the given thread type (diagonal or full coupling) and add
+   * the results to the Jacobian, honoring the selected Jacobian assembly type.
+   */
+  template <typename JacobianThread>
+  void computeElementJacobians(SparseMatrix<Number> & jacobian);
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -568,11 +660,43 @@ protected:
   /// Preconditioning side
   Moose::PCSideType _pc_side;
 
+  /// How element residuals are moved into the global residual vector
+  Moose::ResidualAssemblyType _residual_assembly;
+
+  /// How element Jacobians are moved into the global matrix
+  Moose::JacobianAssemblyType _jacobian_assembly;
+
+  /// Whether or not to reuse the Jacobian and preconditioner until the convergence degrades
+  bool _reuse_jacobian;
+  /// Rebuild the Jacobian once a Newton step takes more linear iterations than this
+  unsigned int _reuse_jacobian_max_linear_its;
+  /// Rebuild the Jacobian once the ratio of successive nonlinear residual norms is larger than this
+  Real _reuse_jacobian_max_contraction;
+  /// Whether the next nonlinear iteration has to compute a new Jacobian
+  bool _force_jacobian_rebuild;
+  /// The time step size the current Jacobian was computed with (LINEAR solves)
+  Real _reuse_jacobian_dt;
+  /// Total number of Jacobian evaluations
+  unsigned int _n_jacobian_evaluations;
+  /// Number of Newton steps done with a reused Jacobian
+  unsigned int _n_jacobian_reuses;
+  /// Number of rebuilds triggered by the linear iteration count
+  unsigned int _n_linear_its_rebuilds;
+  /// Number of rebuilds triggered by the nonlinear contraction rate
+  unsigned int _n_contraction_rebuilds;
+  /// Number of rebuilds forced by mesh changes, time step changes and failed solves
+  unsigned int _n_forced_rebuilds;
+
   /// Whether or not to use a finite differenced preconditioner
   bool _use_finite_differenced_preconditioner;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
+
+  /// The shell matrix used as the Jacobian operator by solve_type = MATRIX_FREE
+  Mat _jacobian_action_operator;
 #endif
+  /// Ghosted copy of the vector the Jacobian is applied to by computeJacobianAction()
+  NumericVector<Number> * _jacobian_action_input;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -36,7 +36,8 @@ public:
                             std::vector<MooseSharedPointer<MaterialData> > & bnd_material_data,
                             MaterialPropertyStorage & material_props,
                             MaterialPropertyStorage & bnd_material_props,
-                            std::vector<Assembly *> & assembly);
+                            std::vector<Assembly *> & assembly,
+                            bool l2_projection = false);
 
   // Splitting Constructor
   ProjectMaterialProperties(ProjectMaterialProperties & x, Threads::split split);
@@ -61,6 +62,8 @@ protected:
   MaterialPropertyStorage & _bnd_material_props;
   std::vector<Assembly *> & _assembly;
   bool _need_internal_side_material;
+  /// Whether packed volume properties are projected with the least squares weights instead of copying the nearest qp
+  bool _l2_projection;
 };
 
 #endif //PROJECTMATERIALPROPERTIES_H
@@ -18,6 +18,7 @@
 //MOOSE includes
 #include "Constraint.h"
 #include "NeighborCoupleableMooseVariableDependencyIntermediateInterface.h"
+#include "CSRMap.h"
 
 //Forward Declarations
 class NodeFaceConstraint;
@@ -198,7 +199,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const CSRMap<dof_id_type> & _node_to_elem_map;
 
   /**
    * Whether or not the slave's residual should be overwritten.
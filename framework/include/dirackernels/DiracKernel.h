@@ -116,6 +116,11 @@ public:
    */
   bool hasPointsOnElem(const Elem * elem);
 
+  /**
+   * The elements of the mesh this DiracKernel acts on where it has something to distribute.
+   */
+  const std::set<const Elem *> & getElementsWithPoints() { return _local_dirac_kernel_info.getElements(); }
+
   /**
    * Whether or not this DiracKernel has something to distribute at this Point.
    */
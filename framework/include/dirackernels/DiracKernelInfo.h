@@ -82,6 +82,12 @@ public:
   /**
    * Used by client DiracKernel classes to determine the Elem in which
    * the Point p resides.  Uses the PointLocator owned by this object.
+   *
+   * The result is remembered for each Point until the mesh changes.
+   * Points that were located before the PointLocator was last rebuilt
+   * (e.g. because the displaced mesh moved) are first checked against
+   * their old element and its face neighbors, and only searched for
+   * again if they left that patch.
    */
   const Elem * findPoint(Point p, const MooseMesh& mesh);
 
@@ -97,6 +103,40 @@ protected:
   /// also needs to be rebuilt in FEProblem::meshChanged() to work with Mesh
   /// adaptivity.
   UniquePtr<PointLocatorBase> _point_locator;
+
+  /// Where findPoint() last located a Point
+  struct CachedLocation
+  {
+    CachedLocation() :
+        _elem(NULL),
+        _locator_generation(0),
+        _round(0)
+    {}
+
+    /// The element containing the Point, NULL if it is not in a local element
+    const Elem * _elem;
+
+    /// The value of _locator_generation when _elem was determined
+    unsigned int _locator_generation;
+
+    /// The value of _round when the Point was last looked up, 0 if never
+    unsigned int _round;
+  };
+
+  /// The locations of the Points passed to findPoint()
+  std::map<Point, CachedLocation> _point_cache;
+
+  /// Incremented every time the PointLocator is rebuilt
+  unsigned int _locator_generation;
+
+  /// The MooseMesh::changeCount() the cached locations belong to
+  unsigned int _mesh_change_count;
+
+  /// Incremented by clearPoints(), used to find the cached Points that are no longer needed.  Starts at 1.
+  unsigned int _round;
+
+  /// The number of cached Points looked up since the last clearPoints()
+  unsigned int _n_points_looked_up;
 };
 
 #endif //DIRACKERNELINFO_H
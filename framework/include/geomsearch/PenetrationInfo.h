@@ -44,6 +44,13 @@ public:
 
   ~PenetrationInfo();
 
+  /**
+   * Reinitialize a used object for a new candidate face, as if it had just been constructed.
+   * The vectors keep their memory so that pooled objects don't allocate.  The side is not
+   * owned by this object (it belongs to the side cache of the PenetrationLocator).
+   */
+  void reset(const Node * node, const Elem * elem, Elem * side, unsigned int side_num);
+
   enum MECH_STATUS_ENUM
   {
     MS_NO_CONTACT=0, // out of contact
@@ -60,6 +67,8 @@ public:
   const Node * _node;
   const Elem * _elem;
   Elem * _side;
+  /// Whether _side was built for this object and is deleted with it
+  bool _owns_side;
   unsigned int _side_num;
   RealVectorValue _normal;
   Real _distance;  //Positive distance means the node has penetrated
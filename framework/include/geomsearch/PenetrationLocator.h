@@ -82,7 +82,32 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() {return _tangential_tolerance;}
 
+  /**
+   * A side of an element on the master boundary.  The side elements share the nodes of the mesh,
+   * so they follow mesh displacements and only have to be rebuilt when the mesh changes.
+   */
+  struct MasterSide
+  {
+    unsigned int _side_num;
+    Elem * _side;
+    /// Reference coordinates of the side centroid, where new contact point searches start
+    Point _centroid_ref;
+  };
+
 protected:
+  /// Build the side elements of all elements on the master boundary
+  void buildMasterSides();
+
+  /// Delete the cached side elements
+  void clearMasterSides();
+
+  /// The sides on the master boundary of each element that has any
+  std::map<dof_id_type, std::vector<MasterSide> > _master_sides;
+  bool _master_sides_built;
+
+  /// PenetrationInfo objects that are free for reuse, one pool per thread
+  std::vector<std::vector<PenetrationInfo *> > _info_pool;
+
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
   bool & _update_location; // Update the penetration location for nodes found last time
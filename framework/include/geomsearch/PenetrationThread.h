@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "PenetrationLocator.h"
 #include "ParallelUniqueId.h"
+#include "CSRMap.h"
 
 // Forward declarations
 class MooseVariable;
@@ -40,10 +41,9 @@ public:
                     std::vector<std::vector<FEBase *> > & fes,
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
-                    std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                    std::vector<dof_id_type> & elem_list,
-                    std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    const CSRMap<dof_id_type> & node_to_elem_map,
+                    std::map<dof_id_type, std::vector<PenetrationLocator::MasterSide> > & master_sides,
+                    std::vector<std::vector<PenetrationInfo *> > & info_pool);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -78,13 +78,16 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const CSRMap<dof_id_type> & _node_to_elem_map;
 
-  std::vector<dof_id_type> & _elem_list;
-  std::vector<unsigned short int> & _side_list;
-  std::vector<boundary_id_type> & _id_list;
+  /// The cached sides of the elements on the master boundary
+  std::map<dof_id_type, std::vector<PenetrationLocator::MasterSide> > & _master_sides;
 
-  unsigned int _n_elems;
+  /// PenetrationInfo objects that are free for reuse, one pool per thread
+  std::vector<std::vector<PenetrationInfo *> > & _info_pool;
+
+  /// The info of the node being searched from the previous search, used to warm start the contact point search
+  const PenetrationInfo * _previous_info;
 
   THREAD_ID _tid;
 
@@ -178,9 +181,23 @@ protected:
                     const std::vector<const Node*> &nodes_that_must_be_on_side,
                     const bool check_whether_reasonable = false);
 
+  /**
+   * Take a PenetrationInfo object out of this thread's pool, or make a new one if the pool is empty
+   */
+  PenetrationInfo *
+  acquireInfo(const Node * node, const Elem * elem, Elem * side, unsigned int side_num);
+
+  /**
+   * Return a PenetrationInfo object to this thread's pool
+   */
   void
-  getSidesOnMasterBoundary(std::vector<unsigned int> &sides,
-                           const Elem *const elem);
+  releaseInfo(PenetrationInfo * info);
+
+  /**
+   * The cached side side_num of elem, if elem is on the master boundary
+   */
+  Elem *
+  getMasterSide(const Elem * elem, unsigned int side_num);
 
   void
   computeSlip( FEBase & fe,
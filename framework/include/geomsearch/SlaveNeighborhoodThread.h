@@ -17,16 +17,19 @@
 
 // MOOSE includes
 #include "MooseTypes.h"
+#include "CSRMap.h"
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
+                          const KDTree & kd_tree,
+                          const CSRMap<dof_id_type> & node_to_elem_map,
                           const unsigned int patch_size);
 
 
@@ -53,8 +56,11 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Spatial index over the trial master nodes (tree indices refer to _trial_master_nodes)
+  const KDTree & _kd_tree;
+
   /// Node to elem map
-  std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const CSRMap<dof_id_type> & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
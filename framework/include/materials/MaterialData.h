@@ -82,8 +82,8 @@ public:
   // material properties for given element (and possible side)
   void swap(const Elem & elem, unsigned int side = 0);
 
-  // Reinit material properties for given element (and possible side)
-  void reinit(const std::vector<MooseSharedPointer<Material> > & mats);
+  // Reinit material properties for given element (and possible side), tid is the thread of this MaterialData
+  void reinit(const std::vector<MooseSharedPointer<Material> > & mats, THREAD_ID tid);
 
   /// Calls the reset method of Materials to ensure that they are in a proper state.
   void reset(const std::vector<MooseSharedPointer<Material> > & mats);
@@ -26,6 +26,25 @@
 #include "libmesh/vector_value.h"
 
 class PropertyValue;
+class RankTwoTensor;
+class RankFourTensor;
+
+/**
+ * Marks types that are made of a fixed number of Reals and nothing else.  Stateful properties
+ * of these types are kept by MaterialPropertyStorage in one contiguous block per element
+ * instead of in separate PropertyValue objects.  Specialize this for other such types.
+ */
+template<typename T>
+struct PackedPropertyType
+{
+  static const bool value = false;
+};
+
+template<> struct PackedPropertyType<Real> { static const bool value = true; };
+template<> struct PackedPropertyType<RealVectorValue> { static const bool value = true; };
+template<> struct PackedPropertyType<RealTensorValue> { static const bool value = true; };
+template<> struct PackedPropertyType<RankTwoTensor> { static const bool value = true; };
+template<> struct PackedPropertyType<RankFourTensor> { static const bool value = true; };
 
 /**
  * Scalar Init helper routine so that specialization isn't needed for basic scalar MaterialProperty types
@@ -81,6 +100,24 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * The number of Reals making up one value of this property if its type can be kept in
+   * packed storage (see PackedPropertyType), zero otherwise.
+   */
+  virtual unsigned int packedSize () const = 0;
+
+  /**
+   * Make this property operate on n_qpoints values held in packed storage at data.  Its own
+   * values are set aside until releasePacked() is called.
+   */
+  virtual void usePacked (Real * data, unsigned int n_qpoints) = 0;
+
+  /**
+   * Go back to the values that were set aside by usePacked().  Does nothing if usePacked()
+   * was not called.
+   */
+  virtual void releasePacked () = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -110,10 +147,11 @@ class MaterialProperty : public PropertyValue
 {
 public:
   /// Explicitly declare a public constructor because we made the copy constructor private
-  MaterialProperty() : PropertyValue() { /* */ }
+  MaterialProperty() : PropertyValue(), _using_packed(false) { /* */ }
 
   virtual ~MaterialProperty()
   {
+    releasePacked();
     _value.release();
   }
 
@@ -168,6 +206,10 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
 
+  virtual unsigned int packedSize () const;
+  virtual void usePacked (Real * data, unsigned int n_qpoints);
+  virtual void releasePacked ();
+
   /**
    * Store the property into a binary stream
    */
@@ -206,6 +248,12 @@ private:
 
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// Our own values while _value refers to packed storage
+  MooseArray<T> _own_value;
+
+  /// Whether _value currently refers to packed storage
+  bool _using_packed;
 };
 
 
@@ -248,6 +296,37 @@ MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const
   _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline unsigned int
+MaterialProperty<T>::packedSize () const
+{
+  return PackedPropertyType<T>::value ? sizeof(T) / sizeof(Real) : 0;
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::usePacked (Real * data, unsigned int n_qpoints)
+{
+  mooseAssert(packedSize() > 0, "Property type can not be packed");
+  mooseAssert(!_using_packed, "Property is already using packed storage");
+
+  _own_value.swap(_value);
+  _value.shallowCopy(reinterpret_cast<T *>(data), n_qpoints);
+  _using_packed = true;
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::releasePacked ()
+{
+  if (_using_packed)
+  {
+    _value.swap(_own_value);
+    _own_value.shallowCopy(static_cast<T *>(NULL), 0);
+    _using_packed = false;
+  }
+}
+
 template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
@@ -309,20 +388,27 @@ template<>
 inline void
 dataStore(std::ostream & stream, MaterialProperties & v, void * context)
 {
-  // Cast this to a vector so we can just piggy back on the vector store capability
-  std::vector<PropertyValue *> & mat_props = static_cast<std::vector<PropertyValue *> &>(v);
+  unsigned int size = v.size();
+  stream.write((char *) &size, sizeof(size));
 
-  storeHelper(stream, mat_props, context);
+  // Properties kept in packed storage leave NULL entries behind, they are stored separately
+  for (unsigned int i = 0; i < size; i++)
+    if (v[i] != NULL)
+      storeHelper(stream, v[i], context);
 }
 
 template<>
 inline void
 dataLoad(std::istream & stream, MaterialProperties & v, void * context)
 {
-  // Cast this to a vector so we can just piggy back on the vector store capability
-  std::vector<PropertyValue *> & mat_props = static_cast<std::vector<PropertyValue *> &>(v);
+  unsigned int size = 0;
+  stream.read((char *) &size, sizeof(size));
+
+  v.resize(size);
 
-  loadHelper(stream, mat_props, context);
+  for (unsigned int i = 0; i < size; i++)
+    if (v[i] != NULL)
+      loadHelper(stream, v[i], context);
 }
 
 // Scalar Init Helper Function
@@ -33,6 +33,13 @@ class QBase;
 /**
  * Stores the stateful material properties computed by materials.
  *
+ * Properties whose type is a fixed number of Reals (see PackedPropertyType) are kept
+ * packed: one block per element side holds the current, old and older values of all
+ * of them, laid out property by property.  swap() makes the properties in MaterialData
+ * refer straight into the block and shift() only relabels which part of every block
+ * is current, old or older.  Properties of other types get a PropertyValue per element
+ * side and state.
+ *
  * Thread-safe
  */
 class MaterialPropertyStorage
@@ -70,6 +77,9 @@ public:
    * @param input_parent_side - the side of the parent for which material properties are prolonged
    * @param input_child - the number of the child
    * @param input_child_side - the side on the child where material properties will be prolonged
+   * @param projection - least squares weights from the parent qps to the qps of each child (see
+   *                     MooseMesh::getRefinementProjection()).  If not NULL, packed properties are
+   *                     projected with them instead of copying the nearest qp.
    */
   void prolongStatefulProps(const std::vector<std::vector<QpMap> > & refinement_map,
                             QBase & qrule,
@@ -79,7 +89,8 @@ public:
                             const Elem & elem,
                             const int input_parent_side,
                             const int input_child,
-                            const int input_child_side);
+                            const int input_child_side,
+                            const std::vector<std::vector<std::vector<Real> > > * projection = NULL);
 
   /**
    * Creates storage for newly created elements from mesh Adaptivity.  Also, copies values from the children to the parent.
@@ -91,6 +102,9 @@ public:
    * @param material_data MaterialData object used for computing the data
    * @param elem The parent element that was just refined
    * @param input_side Side of the element 'elem' (0 for volumetric material properties)
+   * @param projection - least squares weights from the qps of all children to the parent qps (see
+   *                     MooseMesh::getCoarseningProjection()).  If not NULL, packed properties are
+   *                     projected with them instead of copying the nearest qp.
    */
   void restrictStatefulProps(const std::vector<std::pair<unsigned int, QpMap> > & coarsening_map,
                              std::vector<const Elem *> & coarsened_element_children,
@@ -98,7 +112,8 @@ public:
                              QBase & qrule_face,
                              MaterialData & material_data,
                              const Elem & elem,
-                             int input_side=-1);
+                             int input_side=-1,
+                             const std::vector<std::vector<Real> > * projection = NULL);
 
   /**
    * Initialize stateful material properties
@@ -174,6 +189,34 @@ public:
   unsigned int addPropertyOld(const std::string & prop_name);
   unsigned int addPropertyOlder(const std::string & prop_name);
 
+  /**
+   * Whether stateful property i (an index into statefulProps()) is kept in packed storage
+   */
+  bool isPacked(unsigned int i) const { return i < _packed_size.size() && _packed_size[i] > 0; }
+
+  /**
+   * The packed values of stateful property i on the given element side.  Values of consecutive
+   * quadrature points are packedSize() Reals apart.  Returns NULL if there is no storage for
+   * the element side.
+   * @param state 0 for the current, 1 for the old and 2 for the older values
+   */
+  Real * packedProps(const Elem & elem, unsigned int side, unsigned int i, unsigned int state);
+
+  ///@{
+  /**
+   * Save and restore the packed properties (used for restart)
+   */
+  void storePacked(std::ostream & stream, void * context);
+  void loadPacked(std::istream & stream, void * context);
+  ///@}
+
+  /**
+   * Written ahead of the stateful properties in restart files.  Files written before the
+   * properties were packed do not start with it and are rejected instead of being misread.
+   * Change it whenever the layout written by dataStore() changes.
+   */
+  static const unsigned int restart_format = 0x4d505301;
+
   std::vector<unsigned int> & statefulProps() { return _stateful_prop_id_to_prop_id; }
   std::map<unsigned int, std::string> statefulPropNames() { return _prop_names; }
 
@@ -210,28 +253,87 @@ protected:
   unsigned int addPropertyId (const std::string & prop_name);
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
+
+  /// Values of all packed properties of one element side for all states
+  struct PackedBlock
+  {
+    PackedBlock() : _data(NULL), _n_qpoints(0) {}
+
+    Real * _data;
+    unsigned int _n_qpoints;
+  };
+
+  /**
+   * Decide which stateful properties are packed (based on the property types in material_data)
+   * and lay them out.  Only does something the first time it is called.
+   */
+  void setupPackedLayout(MaterialData & material_data);
+
+  /**
+   * Get the packed block of an element side, allocating it if needed
+   */
+  PackedBlock & packedBlock(const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /// Pointer to the values of packed property i for the given state in block
+  Real * packedData(PackedBlock & block, unsigned int i, unsigned int state) const
+  {
+    return block._data + block._n_qpoints * (_packed_state[state] * _packed_qp_size + _packed_offset[i]);
+  }
+
+  /// The number of states (current, old, older) kept in every block
+  unsigned int nPackedStates() const { return _has_older_prop ? 3 : 2; }
+
+  /// Packed storage, indexing: [element][side]
+  HashMap<const Elem *, HashMap<unsigned int, PackedBlock> > _packed_props;
+
+  /// Number of Reals per value of each stateful property, zero for properties that are not packed
+  std::vector<unsigned int> _packed_size;
+
+  /// Offset (in Reals per quadrature point) of each packed property within one state of a block
+  std::vector<unsigned int> _packed_offset;
+
+  /// Number of Reals per quadrature point in one state of a block
+  unsigned int _packed_qp_size;
+
+  /// Which part of every block holds the current, old and older values
+  unsigned int _packed_state[3];
+
+  /// Whether setupPackedLayout() has been done
+  bool _packed_layout_ready;
 };
 
 template<>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  unsigned int format = MaterialPropertyStorage::restart_format;
+  dataStore(stream, format, context);
+
   dataStore(stream, storage.props(), context);
   dataStore(stream, storage.propsOld(), context);
 
   if (storage.hasOlderProperties())
     dataStore(stream, storage.propsOlder(), context);
+
+  storage.storePacked(stream, context);
 }
 
 template<>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  unsigned int format = 0;
+  dataLoad(stream, format, context);
+  if (format != MaterialPropertyStorage::restart_format)
+    mooseError("The stateful material properties in the restart file were written in a different format by another version of MOOSE");
+
   dataLoad(stream, storage.props(), context);
   dataLoad(stream, storage.propsOld(), context);
 
   if (storage.hasOlderProperties())
     dataLoad(stream, storage.propsOlder(), context);
+
+  storage.loadPacked(stream, context);
 }
 
 
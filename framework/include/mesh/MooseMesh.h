@@ -20,6 +20,7 @@
 #include "BndElement.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "CSRMap.h"
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -65,6 +66,12 @@ public:
   Real _distance;
 };
 
+/**
+ * Weights of a least squares projection between two sets of quadrature points, indexing: [to_qp][from_qp].
+ * The projected value at to_qp is sum_from_qp weights[to_qp][from_qp] * value[from_qp].
+ */
+typedef std::vector<std::vector<Real> > QpProjection;
+
 /**
  * MooseMesh wraps a libMesh::Mesh object and enhances its capabilities
  * by caching additional data and storing more state.
@@ -149,9 +156,10 @@ public:
 
   /**
    * If not already created, creates a map from every node to all
-   * elements to which they are connected.
+   * elements to which they are connected.  map[node_id] is a
+   * (possibly empty) read-only list of element ids.
    */
-  std::map<dof_id_type, std::vector<dof_id_type> > & nodeToElemMap();
+  const CSRMap<dof_id_type> & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -160,7 +168,19 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  std::map<dof_id_type, std::vector<dof_id_type> > & nodeToActiveSemilocalElemMap();
+  const CSRMap<dof_id_type> & nodeToActiveSemilocalElemMap();
+
+  /**
+   * An estimate of the memory used by the node based connectivity (the node to
+   * element maps, the node to block map and the boundary node and element lists)
+   * in bytes.
+   */
+  std::size_t connectivityMemoryUsage() const;
+
+  /**
+   * The total wall time spent building the node based connectivity in seconds.
+   */
+  Real connectivityBuildTime() const { return _connectivity_build_time; }
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -242,6 +262,12 @@ public:
   bool changed() const;
   void changed(bool state);
 
+  /**
+   * The number of times meshChanged() has been called.  Objects that cache data derived from the
+   * mesh can compare this against the value they built their cache with.
+   */
+  unsigned int changeCount() const { return _change_count; }
+
   /**
    * Setter/getter for the _is_prepared flag.
    */
@@ -321,6 +347,19 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * getBoundaryElementRange();
 
+  /**
+   * Active local elements grouped by color.  Elements of the same color do not share any nodes,
+   * so their element matrices never touch the same rows.  Only elements whose nodes are all owned
+   * by this processor are colored, the rest are returned by getSharedNodeElementRange().
+   * Built on first use and rebuilt after the mesh changes.
+   */
+  const std::vector<ConstElemRange *> & getColoredElementRanges();
+
+  /**
+   * Active local elements connected to at least one node owned by another processor.
+   */
+  ConstElemRange * getSharedNodeElementRange();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -446,7 +485,7 @@ public:
   /**
    * Return list of blocks to which the given node belongs.
    */
-  const std::set<SubdomainID> & getNodeBlockIds(const Node & node) const;
+  CSRMap<SubdomainID>::Span getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -634,6 +673,24 @@ public:
    */
   const std::vector<std::pair<unsigned int, QpMap> > & getCoarseningMap(const Elem & elem, int input_side);
 
+  /**
+   * Get the least squares projection weights from the volume qps of a parent to the volume qps of each
+   * of its children, indexing: [child].  These fit a linear polynomial to the parent values instead of
+   * copying the value of the nearest qp.  An entry is empty if the qps do not determine such a fit.
+   *
+   * @param elem The element that represents the element type you need the projection for.
+   */
+  const std::vector<QpProjection> & getRefinementProjection(const Elem & elem);
+
+  /**
+   * Get the least squares projection weights from the volume qps of all children to the volume qps
+   * of the parent.  The from qps are numbered child * n_qps_per_child + qp.  Empty if the qps do
+   * not determine a linear fit.
+   *
+   * @param elem The element that represents the element type you need the projection for.
+   */
+  const QpProjection & getCoarseningProjection(const Elem & elem);
+
   /**
    * Change all the boundary IDs for a given side from old_id to
    * new_id.  If delete_prev is true, also actually remove the side
@@ -779,6 +836,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// The number of times meshChanged() has been called
+  unsigned int _change_count;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -812,14 +872,24 @@ protected:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * _bnd_node_range;
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * _bnd_elem_range;
 
+  /// Active local elements sorted by color, the colored ranges refer to slices of this vector
+  std::vector<const Elem *> _colored_elems;
+  /// One range per color (see getColoredElementRanges())
+  std::vector<ConstElemRange *> _colored_elem_ranges;
+  /// Elements connected to nodes owned by other processors (the last slice of _colored_elems)
+  ConstElemRange * _shared_node_elem_range;
+
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
+  CSRMap<dof_id_type> _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type> > _node_to_active_semilocal_elem_map;
+  CSRMap<dof_id_type> _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
+  /// Wall time spent building the node based connectivity
+  Real _connectivity_build_time;
+
   /**
    * A set of subdomain IDs currently present in the mesh.
    * For parallel meshes, includes subdomains defined on other
@@ -842,22 +912,22 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator             bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type> > _bnd_node_ids;
+  /// Sorted node IDs in each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type> > _bnd_node_ids;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator             bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type> > _bnd_elem_ids;
+  /// Sorted elem IDs connected to each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type> > _bnd_elem_ids;
 
   std::map<dof_id_type, Node *> _quadrature_nodes;
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *> > > _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID> > _block_node_list;
+  /// The sorted blocks (domains) each node belongs to
+  CSRMap<SubdomainID> _block_node_list;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type> > _node_set_nodes;
@@ -894,6 +964,23 @@ protected:
 
   void cacheInfo();
   void freeBndNodes();
+
+  /**
+   * Build a map from the nodes of the elements in [begin, end) (only the active
+   * ones if active_only is true) to value(elem) for each of those elements.
+   */
+  template <typename T>
+  void buildNodeMap(CSRMap<T> & map,
+                    const MeshBase::const_element_iterator & begin,
+                    const MeshBase::const_element_iterator & end,
+                    bool active_only,
+                    T (*value)(const Elem *));
+
+  /// Greedily color the active local elements, see getColoredElementRanges()
+  void buildColoredElementRanges();
+
+  /// Delete the colored element ranges
+  void freeColoredElementRanges();
   void freeBndElems();
 
 private:
@@ -971,6 +1058,8 @@ private:
    * @param parent_side - the id of the parent's side
    * @param child - the id of the child element
    * @param child_side - The id of the child's side
+   * @param refinement_projection If not NULL, filled with the least squares weights for refinement (volume to volume only)
+   * @param coarsen_projection If not NULL, filled with the least squares weights for coarsening (volume to volume only)
    */
   void findAdaptivityQpMaps(const Elem * template_elem,
                             QBase & qrule,
@@ -979,7 +1068,9 @@ private:
                             std::vector<std::pair<unsigned int, QpMap> > & coarsen_map,
                             int parent_side,
                             int child,
-                            int child_side);
+                            int child_side,
+                            std::vector<QpProjection> * refinement_projection = NULL,
+                            QpProjection * coarsen_projection = NULL);
 
   /// Holds mappings for volume to volume and parent side to child side
   std::map<std::pair<int, ElemType>, std::vector<std::vector<QpMap> > > _elem_type_to_refinement_map;
@@ -990,6 +1081,12 @@ private:
   /// Holds mappings for volume to volume and parent side to child side
   std::map<std::pair<int, ElemType>, std::vector<std::pair<unsigned int, QpMap> > > _elem_type_to_coarsening_map;
 
+  /// Least squares weights for volume to volume refinement, indexing: [elem type][child]
+  std::map<ElemType, std::vector<QpProjection> > _elem_type_to_refinement_projection;
+
+  /// Least squares weights for volume to volume coarsening
+  std::map<ElemType, QpProjection> _elem_type_to_coarsening_projection;
+
   /// Holds a map from subomdain ids to the boundary ids that are attached to it
   std::map<SubdomainID, std::set<BoundaryID> > _subdomain_boundary_ids;
 
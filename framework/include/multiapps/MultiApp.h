@@ -48,6 +48,12 @@ class SubAppBackups : public std::vector<MooseSharedPointer<Backup> >
  * Multiapps can be loaded on the fly by setting the exporting the appropriate library
  * path using "MOOSE_LIBRARY_PATH" or by specifying a single input file library path
  * in Multiapps InputParameters object.
+ *
+ * The Apps are distributed over the processors of the master App ("max_procs_per_app"), the Apps
+ * that end up on the same processors share one sub communicator and are solved one after another.
+ * They can not be solved concurrently on threads: Moose::swapLibMeshComm() swaps a process wide
+ * communicator and PETSc is not thread safe.  Use more processors (and "report_solve_times" to
+ * find the load imbalance) to spread many small Apps over the cores of a node.
  */
 class MultiApp :
   public MooseObject,
@@ -109,6 +115,13 @@ public:
    */
   virtual bool needsRestoration() { return true; }
 
+  /**
+   * Print the wall time each App spent in the last solveStep() along with the
+   * load imbalance between the processors (if "report_solve_times" is set).
+   * This is collective on the communicator of the master app.
+   */
+  void reportSolveTimes();
+
   /**
    * @param app The global app number to get the Executioner for
    * @return The Executioner associated with that App.
@@ -273,6 +286,12 @@ protected:
   /// call back executed right before app->runInputFile()
   virtual void preRunInputFile();
 
+  /// Start timing the solve of the given local app
+  void startAppSolve(unsigned int local_app);
+
+  /// Stop timing the solve of the given local app
+  void finishAppSolve(unsigned int local_app);
+
   /// The FEProblem this MultiApp is part of
   FEProblem & _fe_problem;
 
@@ -353,6 +372,15 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// Whether or not to print the solve time of each App after every solve
+  bool _report_solve_times;
+
+  /// Wall time spent solving each local App during the last solveStep()
+  std::vector<Real> _app_solve_times;
+
+  /// When the solve of the App currently being timed started
+  Real _app_solve_start;
 };
 
 template<>
@@ -20,6 +20,7 @@
 
 // Forward declarations
 class CSV;
+class OutputThread;
 
 template<>
 InputParameters validParams<CSV>();
@@ -43,6 +44,11 @@ public:
    */
   CSV(const InputParameters & parameters);
 
+  /**
+   * The tables are written on the background output thread unless they are appended
+   */
+  virtual bool supportsAsyncOutput() const { return !_append_only; }
+
 protected:
 
   /**
@@ -77,6 +83,11 @@ protected:
    */
   virtual void outputVectorPostprocessors();
 
+  /**
+   * Queue copies of the tables that need to be written on the output thread
+   */
+  void outputAsync(OutputThread & output_thread);
+
 private:
 
   /// Flag for aligning data in .csv file
@@ -89,6 +100,12 @@ private:
   bool _set_delimiter;
   std::string _delimiter;
 
+  /// Only write new rows instead of rewriting the files
+  bool _append_only;
+
+  /// The number of rows the tables keep in memory with _append_only
+  unsigned int _history;
+
   /// Flag for writting scalar and/or postprocessor data
   bool _write_all_table;
 
@@ -20,6 +20,9 @@
 #include "FileOutput.h"
 #include "RestartableDataIO.h"
 
+// libMesh includes
+#include "libmesh/threads.h"
+
 #include <deque>
 
 // Forward declarations
@@ -45,7 +48,11 @@ struct CheckpointFileNames
 };
 
 /**
+ * Writes the mesh, solution and restartable data needed to recover a simulation.
  *
+ * With "async" enabled the restartable data is serialized into memory during output() and
+ * written to disk on a separate thread while the solve continues.  At most one such write is
+ * in flight at a time, and the files of older checkpoints are only removed once it has finished.
  */
 class Checkpoint : public BasicOutput<FileOutput>
 {
@@ -83,7 +90,37 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Delete the files of the oldest checkpoints until only "num_files" are left.  With "async"
+   * this is only called after waitForSnapshot() so a complete checkpoint is always on disk.
+   */
+  void removeOldCheckpointFiles();
+
+  /**
+   * Wait for the restartable data that is being written on a separate thread (if any)
+   * @return false if writing it failed
+   */
+  bool waitForSnapshot();
+
 private:
+  /// Writes _snapshot on a separate thread
+  class SnapshotWriter
+  {
+  public:
+    SnapshotWriter(Checkpoint & checkpoint) : _checkpoint(checkpoint) {}
+
+    void operator()()
+    {
+      _checkpoint._snapshot_written = RestartableDataIO::writeRestartableDataFiles(_checkpoint._snapshot_file_base,
+                                                                                   _checkpoint._snapshot_proc_id,
+                                                                                   _checkpoint._snapshot);
+    }
+
+  private:
+    Checkpoint & _checkpoint;
+  };
+
+  friend class SnapshotWriter;
 
   /// Max no. of output files to store
   unsigned int _num_files;
@@ -114,6 +151,24 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// True if the restartable data is written on a separate thread
+  bool _async;
+
+  /// Restartable data waiting to be written, one entry per thread
+  std::vector<std::string> _snapshot;
+
+  /// The base filename _snapshot is written to
+  std::string _snapshot_file_base;
+
+  /// The processor id used in the filenames of _snapshot
+  processor_id_type _snapshot_proc_id;
+
+  /// Whether _snapshot was written successfully
+  bool _snapshot_written;
+
+  /// The thread writing _snapshot
+  MooseSharedPointer<Threads::Thread> _write_thread;
 };
 
 #endif //CHECKPOINT_H
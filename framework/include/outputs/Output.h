@@ -125,6 +125,11 @@ public:
    */
   void allowOutput(bool state) { _allow_output = state; }
 
+  /**
+   * Whether this object writes its files on the background output thread when Outputs/async is set
+   */
+  virtual bool supportsAsyncOutput() const { return false; }
+
   /**
    * A static helper for injecting deprecated parameters
    */
@@ -0,0 +1,131 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OUTPUTTHREAD_H
+#define OUTPUTTHREAD_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// System includes
+#include <deque>
+
+/**
+ * A piece of output that is written by the OutputThread.
+ *
+ * A job must own everything it writes (a snapshot of the data, not a reference to it) and may only
+ * touch the filesystem: it runs concurrently with the solve and must not communicate.
+ */
+class OutputJob
+{
+public:
+  virtual ~OutputJob() {}
+
+  /**
+   * Write the data, called on the output thread
+   */
+  virtual void write() = 0;
+};
+
+/**
+ * Writes OutputJobs on a separate thread in the order they were enqueued.
+ *
+ * A writer thread is started when a job is enqueued and none is running, it writes jobs until the
+ * queue is empty and exits.  The queue is bounded: when it is full enqueue() blocks until the
+ * writer has caught up, so at most max_queue_size snapshots are held in memory at a time.  If
+ * libMesh is built without thread support the jobs are written as soon as they are enqueued.
+ */
+class OutputThread
+{
+public:
+  /**
+   * @param max_queue_size The number of jobs that may be waiting to be written
+   */
+  OutputThread(unsigned int max_queue_size);
+
+  /**
+   * Writes everything that is still queued
+   */
+  virtual ~OutputThread();
+
+  /**
+   * Add a job to the queue, blocks while the queue is full
+   */
+  void enqueue(MooseSharedPointer<OutputJob> job);
+
+  /**
+   * Block until every job that was enqueued has been written
+   */
+  void drain();
+
+  /// The number of jobs written so far
+  unsigned int numWritten();
+
+  /// Wall time (in seconds) spent writing on the output thread
+  Real writeTime();
+
+  /// Wall time (in seconds) the caller spent blocked in enqueue() and drain()
+  Real waitTime();
+
+  /// Wall time (in seconds) of writing that overlapped with the work of the caller
+  Real overlapTime();
+
+protected:
+  /// Write jobs until the queue is empty, called on the writer thread
+  void writeJobs();
+
+  /// Wait for the writer thread (if any) to finish
+  void joinWriter();
+
+  /// The maximum number of jobs waiting to be written
+  unsigned int _max_queue_size;
+
+  /// The jobs waiting to be written
+  std::deque<MooseSharedPointer<OutputJob> > _queue;
+
+  /// True from the start of the writer thread until it found the queue empty
+  bool _writing;
+
+  /// Statistics
+  unsigned int _num_written;
+  Real _write_time;
+  Real _wait_time;
+
+  /// Protects everything above
+  Threads::spin_mutex _mutex;
+
+private:
+  /// Runs writeJobs() on the writer thread
+  class Writer
+  {
+  public:
+    Writer(OutputThread & output_thread) : _output_thread(output_thread) {}
+
+    void operator()() { _output_thread.writeJobs(); }
+
+  private:
+    OutputThread & _output_thread;
+  };
+
+  friend class Writer;
+
+  /// The thread writing the queued jobs, only accessed by the thread that owns this object
+  MooseSharedPointer<Threads::Thread> _writer;
+};
+
+#endif // OUTPUTTHREAD_H
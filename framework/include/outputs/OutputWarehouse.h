@@ -21,6 +21,7 @@
 // Forward declarations
 class FEProblem;
 class InputParameters;
+class OutputThread;
 
 /**
  * Class for storing and utilizing output objects
@@ -189,6 +190,24 @@ public:
    */
   void bufferConsoleOutputsBeforeConstruction(bool buffer) { _buffer_action_console_outputs = buffer; }
 
+  /**
+   * Start the thread used by output objects to write their files in the background
+   * @param max_queue_size The number of snapshots that may be waiting to be written
+   *
+   * @see CommonOutputAction
+   */
+  void enableAsyncOutput(unsigned int max_queue_size);
+
+  /**
+   * The thread for writing output in the background, NULL if asynchronous output is disabled
+   */
+  OutputThread * asyncOutput() { return _output_thread.get(); }
+
+  /**
+   * Block until all output queued for the background thread has been written
+   */
+  void waitForAsyncOutput();
+
 private:
 
   /**
@@ -223,6 +242,9 @@ private:
    */
   std::vector<MooseSharedPointer<Output> > _all_ptrs;
 
+  /// Background output thread (declared after the objects so it is stopped before they are destroyed)
+  MooseSharedPointer<OutputThread> _output_thread;
+
   /**
    * Adds the file name to the list of filenames being output
    * The main function of this object is to test that the same output file
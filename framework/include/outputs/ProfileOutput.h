@@ -0,0 +1,49 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PROFILEOUTPUT_H
+#define PROFILEOUTPUT_H
+
+// MOOSE includes
+#include "BasicOutput.h"
+#include "FileOutput.h"
+
+// Forward declarations
+class ProfileOutput;
+
+template<>
+InputParameters validParams<ProfileOutput>();
+
+/**
+ * Turns on the per-object timers (see ObjectProfiler) and writes what they collected,
+ * combined over all threads and processors, as a flame graph JSON file and a CSV summary.
+ */
+class ProfileOutput : public BasicOutput<FileOutput>
+{
+public:
+  ProfileOutput(const InputParameters & parameters);
+
+  /**
+   * The name of the JSON file, the CSV summary uses the same name with a .csv extension
+   */
+  virtual std::string filename();
+
+protected:
+  /**
+   * Write the files
+   */
+  virtual void output(const ExecFlagType & type);
+};
+
+#endif /* PROFILEOUTPUT_H */
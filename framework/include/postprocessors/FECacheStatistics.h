@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FECACHESTATISTICS_H
+#define FECACHESTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class FECacheStatistics;
+
+template<>
+InputParameters validParams<FECacheStatistics>();
+
+/**
+ * Reports how well the FE shape function cache (Problem/fe_cache) is doing,
+ * summed over all threads and processors.
+ */
+class FECacheStatistics : public GeneralPostprocessor
+{
+public:
+  FECacheStatistics(const InputParameters & parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  virtual Real getValue();
+
+protected:
+  enum StatisticEnum
+  {
+    HITS,
+    MISSES,
+    HIT_RATE,
+    ENTRIES,
+    MEMORY,
+    REINITS,
+    SKIPPED_REINITS
+  };
+
+  const StatisticEnum _statistic;
+};
+
+#endif //FECACHESTATISTICS_H
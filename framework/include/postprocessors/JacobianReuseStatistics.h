@@ -0,0 +1,53 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef JACOBIANREUSESTATISTICS_H
+#define JACOBIANREUSESTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class JacobianReuseStatistics;
+
+template<>
+InputParameters validParams<JacobianReuseStatistics>();
+
+/**
+ * Reports the decisions of the Jacobian reuse policy (Executioner/reuse_jacobian)
+ * accumulated over the whole calculation.
+ */
+class JacobianReuseStatistics : public GeneralPostprocessor
+{
+public:
+  JacobianReuseStatistics(const InputParameters & parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  virtual Real getValue();
+
+protected:
+  enum StatisticEnum
+  {
+    EVALUATIONS,
+    REUSES,
+    LINEAR_REBUILDS,
+    CONTRACTION_REBUILDS,
+    FORCED_REBUILDS
+  };
+
+  const StatisticEnum _statistic;
+};
+
+#endif //JACOBIANREUSESTATISTICS_H
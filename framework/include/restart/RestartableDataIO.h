@@ -23,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <list>
+#include <vector>
 
 // Forward declarations
 class RestartableDatas;
@@ -32,7 +33,11 @@ class FEProblem;
 /**
  * Class for doing restart.
  *
- * It takes care of writing and reading the restart files.
+ * It takes care of writing and reading the restart files.  Every thread of every processor
+ * writes its own file.  A file starts with a header holding an index of the data it contains
+ * (name, offset and size of every piece of data), padded so the data itself starts on an
+ * aligned boundary.  Each piece of data can optionally be compressed.  Files are written with
+ * a single large write and mapped into memory when they are read back.
  */
 class RestartableDataIO
 {
@@ -46,6 +51,25 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serialize the restartable data of every thread into memory.  snapshot[tid] receives exactly
+   * what writeRestartableData() would write to the file of thread tid.
+   */
+  void snapshotRestartableData(const RestartableDatas & restartable_datas, std::vector<std::string> & snapshot);
+
+  /**
+   * Write a snapshot created by snapshotRestartableData() to the files of processor proc_id.
+   * Every file is written under a temporary name first and renamed once it is complete.  This
+   * only touches the filesystem so it may be called from a thread other than the main one.
+   * @return false if any of the files could not be written
+   */
+  static bool writeRestartableDataFiles(const std::string & base_file_name, processor_id_type proc_id, const std::vector<std::string> & snapshot);
+
+  /**
+   * Turn compression of the data written from now on on or off.  Reading always handles both.
+   */
+  void setCompression(bool compress);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
    */
@@ -67,15 +91,18 @@ public:
   void restoreBackup(MooseSharedPointer<Backup> backup, bool for_restart = false);
 
 private:
+  /// A restartable data file mapped into memory
+  class MappedFile;
+
   /**
    * Serializes the data into the stream object.
    */
   void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream);
 
   /**
-   * Deserializes the data from the stream object.
+   * Deserializes the data from the size bytes starting at data (the full contents of a file).
    */
-  void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::istream & stream, const std::set<std::string> & recoverable_data);
+  void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, const char * data, std::size_t size, const std::set<std::string> & recoverable_data);
 
   /**
    * Serializes the data for the Systems in FEProblem
@@ -90,8 +117,11 @@ private:
   /// Reference to a FEProblem being restarted
   FEProblem & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<MooseSharedPointer<std::ifstream> > _in_file_handles;
+  /// Whether the data is compressed when it is written
+  bool _compress;
+
+  /// The files being read, one per thread
+  std::vector<MooseSharedPointer<MappedFile> > _in_files;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
@@ -60,17 +60,38 @@ protected:
   Real bboxMaxDistance(Point p, MeshTools::BoundingBox bbox);
 
   /**
-   * Return the distance between the given point and the nearest corner of the
-   * given bounding box.
-   * @param p The point to evaluate all distances from.
+   * Return the distance between the given point and the given bounding box.
+   * @param p The point to evaluate the distance from.
    * @param bbox The bounding box to evaluate the distance to.
-   * @return The minimum distance between the point p and the eight corners of
-   * the bounding box bbox.
+   * @return The distance between p and the closest point of bbox (zero if
+   * bbox contains p).
+   */
+  Real bboxDistance(const Point & p, const MeshTools::BoundingBox & bbox);
+
+  /**
+   * Whether the bounding box is the inverted box getSourceBoundingBoxes() uses
+   * for "from" domains without source nodes.
    */
-  Real bboxMinDistance(Point p, MeshTools::BoundingBox bbox);
+  bool isEmptyBox(const MeshTools::BoundingBox & bbox);
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Collect the positions (translated by the "from" positions) and dofs of the
+   * local source nodes that carry the source variable for each local "from" domain.
+   */
+  void getSourceNodes(unsigned int n_local_froms,
+                      std::vector<std::vector<Point> > & source_points,
+                      std::vector<std::vector<dof_id_type> > & source_dofs);
+
+  /**
+   * Return the bounding boxes around the source nodes of every "from" domain on
+   * every processor.  Unlike getFromBoundingBoxes() these only cover the nodes
+   * that are actually searched, so they give a valid bound on the nearest node
+   * distance even when a source boundary is used.
+   */
+  std::vector<MeshTools::BoundingBox> getSourceBoundingBoxes(const std::vector<std::vector<Point> > & source_points);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
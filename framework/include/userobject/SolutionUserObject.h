@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "GeneralUserObject.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 namespace libMesh
@@ -26,6 +27,7 @@ class EquationSystems;
 class System;
 class MeshFunction;
 template<class T> class NumericVector;
+template<typename T> class DenseVector;
 }
 
 // Forward declarations
@@ -38,7 +40,9 @@ InputParameters validParams<SolutionUserObject>();
  * User object that reads an existing solution from an input file and
  * uses it in the current simulation.
  */
-class SolutionUserObject : public GeneralUserObject
+class SolutionUserObject :
+  public GeneralUserObject,
+  public MeshChangedInterface
 {
 public:
   SolutionUserObject(const InputParameters & parameters);
@@ -78,6 +82,19 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const unsigned int local_var_index) const;
 
+  /**
+   * Returns the values of several variables at several locations at once. Each point is
+   * transformed and located only once (per time slice) for all of the requested variables.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param points The locations at which to return values
+   * @param local_var_indices The local indices of the variables to be evaluated
+   * @param values Filled with the values, values[i][j] is variable local_var_indices[j] at points[i]
+   */
+  void pointValues(Real t,
+                   const std::vector<Point> & points,
+                   const std::vector<unsigned int> & local_var_indices,
+                   std::vector<std::vector<Real> > & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -106,6 +123,9 @@ public:
   /// Initialize the System and Mesh objects for the solution being read
   virtual void initialSetup();
 
+  /// Rebuild the part of the solution kept on this processor (when "serialize_solution = false")
+  virtual void meshChanged();
+
 
   const std::vector<std::string> & variableNames() const;
 
@@ -161,6 +181,41 @@ protected:
    */
   Real evalMeshFunction(const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
+  /**
+   * Evaluate all of the variables of a MeshFunction at once
+   * @param p The location at which data is desired
+   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param output Filled with the value of every variable (empty if p is outside of the mesh)
+   */
+  void evalMeshFunction(const Point & p, unsigned int func_num, DenseVector<Number> & output) const;
+
+  /**
+   * Map a point of the simulation to the corresponding point of the mesh that was read
+   */
+  Point transformPoint(const Point & p) const;
+
+  /**
+   * Copy the solution of a System into one of the solution vectors used for evaluation.
+   * This either pulls down the complete vector or only the dofs in _needed_dofs.
+   */
+  void localizeSolution(System & system, NumericVector<Number> & local_solution);
+
+  /**
+   * Build the list of dofs needed to evaluate the solution near the local part of the
+   * simulation mesh (used when "serialize_solution = false")
+   */
+  void buildNeededDofs();
+
+  /**
+   * Create a vector able to hold the solution of the read system that localizeSolution() can fill
+   */
+  NumericVector<Number> * buildLocalSolution();
+
+  /**
+   * (Re)initialize a vector created by buildLocalSolution() for the current _needed_dofs
+   */
+  void initLocalSolution(NumericVector<Number> & local_solution);
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -263,6 +318,18 @@ protected:
   /// transformations (rotations, translation, scales) are performed in this order
   MultiMooseEnum _transformation_order;
 
+  /// All of the transformations combined into one affine map: p -> _transform_matrix * p + _transform_offset
+  RealTensorValue _transform_matrix;
+
+  /// Offset of the combined affine transformation
+  RealVectorValue _transform_offset;
+
+  /// Whether every processor keeps a complete copy of the solution
+  bool _serialize_solution;
+
+  /// Non-local dofs of the elements near the local part of the simulation mesh (when not serializing)
+  std::vector<dof_id_type> _needed_dofs;
+
   /// True if initial_setup has executed
   bool _initialized;
 };
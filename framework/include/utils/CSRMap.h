@@ -0,0 +1,261 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef CSRMAP_H
+#define CSRMAP_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+#include "MooseError.h"
+
+// libMesh includes
+#include "libmesh/id_types.h"
+
+// System includes
+#include <algorithm>
+#include <map>
+#include <vector>
+
+/**
+ * A compressed sparse row (CSR) map from ids, e.g. node ids, to short lists
+ * of values, e.g. the ids of the elements connected to each node.  All of the
+ * lists are stored back to back in one array, with a second array of offsets
+ * indexed by id, so a lookup is two array reads and the whole map is two
+ * allocations instead of a tree node and a vector per id.
+ *
+ * The ids are expected to be mostly dense in the range passed to reset(), like
+ * the nodes of a mesh.  Lists for ids that are added separately, like
+ * quadrature nodes, are kept in a small side map (see append()) that is not
+ * affected by rebuilding the compressed storage.
+ *
+ * The map is built in two passes over the same entries:
+ *
+ *   map.reset(min_id, max_id);
+ *   for each entry: map.count(id);
+ *   map.allocate();
+ *   for each entry, in the same order: map.insert(id, value);
+ *   map.finalize();
+ *
+ * The values of each id keep the order in which they were inserted.
+ */
+template <typename T>
+class CSRMap
+{
+public:
+  /**
+   * A read-only view of the values of one id
+   */
+  class Span
+  {
+  public:
+    typedef const T * const_iterator;
+
+    Span() :
+        _begin(NULL),
+        _end(NULL)
+    {}
+
+    Span(const T * begin, const T * end) :
+        _begin(begin),
+        _end(end)
+    {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+
+    const T & operator[](std::size_t i) const { return _begin[i]; }
+
+  private:
+    const T * _begin;
+    const T * _end;
+  };
+
+  CSRMap() :
+      _min_id(0)
+  {}
+
+  /**
+   * Remove all entries, including the appended ones, and release the memory
+   */
+  void clear()
+  {
+    std::vector<dof_id_type>().swap(_offsets);
+    std::vector<T>().swap(_values);
+    _extra.clear();
+    _min_id = 0;
+  }
+
+  /**
+   * Start building the map for the ids min_id,...,max_id.  If max_id < min_id the compressed
+   * storage is left empty.  The values added with append() are kept.
+   */
+  void reset(dof_id_type min_id, dof_id_type max_id)
+  {
+    std::vector<dof_id_type>().swap(_offsets);
+    std::vector<T>().swap(_values);
+    _min_id = 0;
+
+    if (max_id < min_id)
+      return;
+
+    _min_id = min_id;
+    _offsets.assign(max_id - min_id + 2, 0);
+  }
+
+  /**
+   * First pass: count one value for id
+   */
+  void count(dof_id_type id)
+  {
+    mooseAssert(inRange(id), "Id " << id << " is outside of the range of the CSRMap");
+    ++_offsets[id - _min_id + 1];
+  }
+
+  /**
+   * Allocate the storage for the counted values
+   */
+  void allocate()
+  {
+    for (std::size_t i = 1; i < _offsets.size(); ++i)
+      _offsets[i] += _offsets[i - 1];
+
+    _values.resize(_offsets.empty() ? 0 : _offsets.back());
+  }
+
+  /**
+   * Second pass: store value for id.  Until finalize() is called, _offsets[i]
+   * is the position of the next value of the i-th id.
+   */
+  void insert(dof_id_type id, const T & value)
+  {
+    mooseAssert(inRange(id), "Id " << id << " is outside of the range of the CSRMap");
+    _values[_offsets[id - _min_id]++] = value;
+  }
+
+  /**
+   * Finish building the map.  All of the counted values must have been inserted.
+   */
+  void finalize()
+  {
+    if (_offsets.empty())
+      return;
+
+    // insert() has moved the start of every list to the start of the next one
+    for (std::size_t i = _offsets.size() - 1; i > 0; --i)
+      _offsets[i] = _offsets[i - 1];
+
+    _offsets[0] = 0;
+  }
+
+  /**
+   * Sort the values of every id and remove duplicates, compacting the storage.
+   */
+  void sortAndRemoveDuplicates()
+  {
+    dof_id_type new_end = 0;
+
+    for (std::size_t i = 0; i + 1 < _offsets.size(); ++i)
+    {
+      const dof_id_type old_begin = _offsets[i];
+      typename std::vector<T>::iterator begin = _values.begin() + old_begin;
+      typename std::vector<T>::iterator end = _values.begin() + _offsets[i + 1];
+
+      std::sort(begin, end);
+      end = std::unique(begin, end);
+
+      // Lists only ever move towards the front
+      _offsets[i] = new_end;
+      if (new_end != old_begin)
+        std::copy(begin, end, _values.begin() + new_end);
+      new_end += end - begin;
+    }
+
+    if (!_offsets.empty())
+      _offsets.back() = new_end;
+
+    std::vector<T>(_values.begin(), _values.begin() + new_end).swap(_values);
+  }
+
+  /**
+   * Add a value for an id that is outside of the compressed storage or has no
+   * values in it (e.g. a node that was added after the map was built).
+   */
+  void append(dof_id_type id, const T & value)
+  {
+    mooseAssert(!inRange(id) || _offsets[id - _min_id] == _offsets[id - _min_id + 1],
+                "Cannot append to id " << id << " which already has values in the CSRMap");
+    _extra[id].push_back(value);
+  }
+
+  /**
+   * The values of id, an empty Span if there are none
+   */
+  Span operator[](dof_id_type id) const
+  {
+    if (inRange(id))
+    {
+      const dof_id_type i = id - _min_id;
+      if (_offsets[i + 1] != _offsets[i])
+        return Span(&_values[0] + _offsets[i], &_values[0] + _offsets[i + 1]);
+    }
+
+    if (!_extra.empty())
+    {
+      typename std::map<dof_id_type, std::vector<T> >::const_iterator it = _extra.find(id);
+      if (it != _extra.end() && !it->second.empty())
+        return Span(&it->second[0], &it->second[0] + it->second.size());
+    }
+
+    return Span();
+  }
+
+  /**
+   * Whether id has any values
+   */
+  bool contains(dof_id_type id) const { return !(*this)[id].empty(); }
+
+  /**
+   * An estimate of the memory used by the map in bytes
+   */
+  std::size_t memoryUsage() const
+  {
+    std::size_t bytes = _offsets.capacity() * sizeof(dof_id_type) + _values.capacity() * sizeof(T);
+
+    for (typename std::map<dof_id_type, std::vector<T> >::const_iterator it = _extra.begin(); it != _extra.end(); ++it)
+      bytes += sizeof(*it) + 4 * sizeof(void *) + it->second.capacity() * sizeof(T);
+
+    return bytes;
+  }
+
+protected:
+  /// Whether id is inside the compressed storage
+  bool inRange(dof_id_type id) const { return id >= _min_id && id - _min_id + 1 < _offsets.size(); }
+
+  /// The first id in the compressed storage
+  dof_id_type _min_id;
+
+  /// The values of id are _values[_offsets[id - _min_id]],...,_values[_offsets[id - _min_id + 1] - 1]
+  std::vector<dof_id_type> _offsets;
+
+  /// The values of all ids in the compressed storage, back to back
+  std::vector<T> _values;
+
+  /// The values of ids added with append()
+  std::map<dof_id_type, std::vector<T> > _extra;
+};
+
+#endif // CSRMAP_H
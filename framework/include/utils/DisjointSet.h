@@ -0,0 +1,74 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DISJOINTSET_H
+#define DISJOINTSET_H
+
+// System includes
+#include <vector>
+#include <cstddef>
+
+/**
+ * A disjoint-set (union-find) forest over the integers [0, size()).  Sets are
+ * joined with merge() and identified by their root, which is always the
+ * smallest member of the set, so the result does not depend on the order of the
+ * merges.  find() halves the path it walks so repeated queries stay cheap.
+ */
+class DisjointSet
+{
+public:
+  /**
+   * Start with n singleton sets
+   */
+  DisjointSet(std::size_t n = 0);
+
+  /**
+   * Grow (or shrink) the forest to n elements, new elements are singletons
+   */
+  void resize(std::size_t n);
+
+  /**
+   * The number of elements
+   */
+  std::size_t size() const { return _parent.size(); }
+
+  /**
+   * The root (smallest member) of the set containing i
+   */
+  std::size_t find(std::size_t i);
+
+  /**
+   * Join the sets containing a and b and return the root of the joined set
+   */
+  std::size_t merge(std::size_t a, std::size_t b);
+
+  /**
+   * Whether a and b are in the same set
+   */
+  bool connected(std::size_t a, std::size_t b) { return find(a) == find(b); }
+
+  /**
+   * The number of distinct sets
+   */
+  std::size_t numSets() const { return _num_sets; }
+
+protected:
+  /// The parent of each element, roots are their own parent
+  std::vector<std::size_t> _parent;
+
+  /// The number of distinct sets
+  std::size_t _num_sets;
+};
+
+#endif // DISJOINTSET_H
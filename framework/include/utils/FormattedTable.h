@@ -91,6 +91,22 @@ public:
    */
   void printCSV(const std::string & file_name, int interval=1, bool align = false);
 
+  /**
+   * Method for writing the table to a csv file without rewriting what is already there: only the
+   * rows added since the last call (and the last row written, which may have been added to since)
+   * are written.  A new header line is written whenever the columns change.
+   *
+   * Note: Only call this on processor 0!
+   */
+  void appendCSV(const std::string & file_name);
+
+  /**
+   * Drops all but the last max_rows rows from the table, so that the memory used by tables that
+   * are written with appendCSV() does not grow with the number of time steps.  The last row is
+   * always kept.
+   */
+  void pruneHistory(unsigned int max_rows);
+
   void printEnsight(const std::string & file_name);
   void writeExodus(ExodusII_IO * ex_out, Real time);
   void makeGnuplot(const std::string & base_file, const std::string & format);
@@ -117,6 +133,23 @@ protected:
   void printRowDivider(std::ostream & out, std::map<std::string, unsigned short> & col_widths,
                        std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
 
+  /**
+   * Opens the csv file, unless it is already open.  With append the file written before a
+   * restart or recover is continued (see resumeCSV()), otherwise it is truncated.
+   */
+  void openCSV(const std::string & file_name, bool append = false);
+
+  /**
+   * Opens the existing csv file without truncating it and positions appendCSV() on the row of
+   * _last_key, the last row restored from the restart data.  Returns false if the file or the
+   * row can't be found.
+   */
+  bool resumeCSV();
+
+  /// Write the csv header line / one row of the table to the csv file
+  void printCSVHeader(std::map<std::string, unsigned int> & width, bool align);
+  void printCSVRow(Real key, std::map<std::string, Real> & row, std::map<std::string, unsigned int> & width, bool align);
+
   void printNoDataRow(char intersect_char, char fill_char,
                       std::ostream & out, std::map<std::string, unsigned short> & col_widths,
                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
@@ -154,6 +187,19 @@ protected:
   /// Whether or not to output the Time column
   bool _output_time;
 
+  /// Whether or not appendCSV() wrote any rows to the open file
+  bool _csv_rows_written;
+
+  /// The key and the file position of the last row written by appendCSV()
+  Real _last_written_key;
+  std::streampos _last_row_pos;
+
+  /// The columns of the last header written by appendCSV()
+  std::set<std::string> _written_column_names;
+
+  /// Whether the table was loaded from restart data and appendCSV() has not opened a file since
+  bool _resume_csv;
+
 private:
 
   /// *.csv file delimiter, defaults to ","
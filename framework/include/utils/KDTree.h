@@ -0,0 +1,101 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+#include <utility>
+
+/**
+ * A static k-d tree over a set of points used to answer nearest
+ * and k-nearest neighbor queries in logarithmic time.  The tree keeps
+ * a copy of the points it was built from; the indices returned by the
+ * search routines refer to positions in the vector that was passed to
+ * the constructor.
+ */
+class KDTree
+{
+public:
+  /**
+   * Build the tree.
+   * @param points The points to search against
+   * @param max_leaf_size The maximum number of points stored in a leaf
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the (up to) patch_size points closest to query_point.  The indices
+   * are returned in order of increasing distance.
+   */
+  void neighborSearch(const Point & query_point,
+                      unsigned int patch_size,
+                      std::vector<std::size_t> & return_index) const;
+
+  /**
+   * Find the index of the point closest to query_point.  The squared
+   * distance is returned in distance_sq.
+   */
+  std::size_t nearest(const Point & query_point, Real & distance_sq) const;
+
+  /**
+   * The number of points stored in the tree
+   */
+  std::size_t size() const { return _points.size(); }
+
+protected:
+  /// A node of the tree.  Leaves have no children and own [_begin, _end) of _index.
+  struct Node
+  {
+    unsigned int _split_dim;
+    Real _split_value;
+    std::size_t _begin;
+    std::size_t _end;
+    std::size_t _left;
+    std::size_t _right;
+  };
+
+  /// Recursively build the subtree holding [begin, end) of _index, returns the node position
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  /// Recursively search the subtree rooted at node_id, "heap" is a max-heap of the best candidates
+  void search(std::size_t node_id,
+              const Point & query_point,
+              unsigned int k,
+              std::vector<std::pair<Real, std::size_t> > & heap) const;
+
+  /// The points we are searching against
+  std::vector<Point> _points;
+
+  /// Permutation of point indices, each leaf refers to a contiguous slice of this
+  std::vector<std::size_t> _index;
+
+  /// Tree storage, the root is always the first entry
+  std::vector<Node> _nodes;
+
+  /// The maximum number of points in a leaf
+  unsigned int _max_leaf_size;
+
+  /// Marks a missing child
+  static const std::size_t invalid_node;
+};
+
+#endif // KDTREE_H
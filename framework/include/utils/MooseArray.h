@@ -166,6 +166,13 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Makes _this_ object operate on size values starting at data, which it
+   * does not own.  The same warnings as above apply: never release() or grow
+   * an array that was set up this way.
+   */
+  void shallowCopy(T * data, unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -321,6 +328,16 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template<typename T>
+inline
+void
+MooseArray<T>::shallowCopy(T * data, unsigned int size)
+{
+  _data = data;
+  _size = size;
+  _allocated_size = size;
+}
+
 template<typename T>
 inline
 MooseArray<T> &
@@ -201,7 +201,26 @@ enum SolveType
   ST_JFNK,             ///< Jacobian-Free Newton Krylov
   ST_NEWTON,           ///< Full Newton Solve
   ST_FD,               ///< Use finite differences to compute Jacobian
-  ST_LINEAR            ///< Solving a linear problem
+  ST_LINEAR,           ///< Solving a linear problem
+  ST_MATRIX_FREE       ///< Newton Krylov with Jacobian-vector products applied element by element
+};
+
+/**
+ * How element residual contributions are added to the global residual vector
+ */
+enum ResidualAssemblyType
+{
+  RA_LOCKED,           ///< Periodically add the per-thread cache to the residual under the global lock
+  RA_THREAD_LOCAL      ///< Keep all contributions in the per-thread cache and add them once after the element loop
+};
+
+/**
+ * How element Jacobian contributions are added to the global matrix
+ */
+enum JacobianAssemblyType
+{
+  JA_LOCKED,           ///< Periodically add the per-thread cache to the matrix under the global lock
+  JA_COLORED           ///< Loop over the mesh color by color and add element matrices without locking
 };
 
 /**
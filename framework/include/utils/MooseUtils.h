@@ -74,6 +74,12 @@ namespace MooseUtils
    */
   void parallelBarrierNotify(const libMesh::Parallel::Communicator & comm);
 
+  /**
+   * The current wall clock time in seconds, for timing parts of a simulation.  This uses a monotonic
+   * clock where one is available, so only differences between two calls are meaningful.
+   */
+  libMesh::Real wallTime();
+
   /**
    * Function tests if the supplied filename as the desired extension
    * @param filename The filename to test the extension
@@ -246,6 +252,7 @@ namespace MooseUtils
 
   /**
    * Returns the most recent checkpoint file given a list of files.
+   * Checkpoints without restartable data files are skipped.
    * If a suitable file isn't found the empty string is returned
    * @param checkpoint_files the list of files to analyze
    */
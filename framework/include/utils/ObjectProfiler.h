@@ -0,0 +1,159 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTPROFILER_H
+#define OBJECTPROFILER_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// System includes
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Hierarchical wall clock timers for individual objects (Kernels, Materials, UserObjects, ...).
+ *
+ * Each thread keeps its own tree of timers: a timer started while another one is running
+ * becomes its child, so both the inclusive time (with children) and the self time (without)
+ * are known for every object in every context it is called from.  When sampling is enabled
+ * only every n-th call of a timer reads the clock and the measured time is scaled by n; the
+ * number of calls is always exact.
+ *
+ * The global instance is Moose::object_profiler, it is switched on by the Profile output.
+ */
+class ObjectProfiler
+{
+public:
+  ObjectProfiler();
+
+  /**
+   * Start collecting timings
+   * @param sampling_interval Read the clock on every sampling_interval-th call of each timer
+   */
+  void enable(unsigned int sampling_interval = 1);
+
+  /**
+   * Stop collecting timings, what was collected so far is kept
+   */
+  void disable();
+
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Forget everything collected so far
+   */
+  void clear();
+
+  /**
+   * Start the timer of an object, nested in the timer that is currently running on thread tid
+   * @param key Identifies the object (normally its address)
+   * @param name The name of the object
+   * @param category The kind of object (e.g. "Kernel")
+   */
+  void start(THREAD_ID tid, const void * key, const std::string & name, const char * category);
+
+  /**
+   * Stop the timer that was started last on thread tid
+   */
+  void stop(THREAD_ID tid);
+
+  /**
+   * Times an object for as long as it is in scope (does nothing when the profiler is disabled)
+   */
+  class Timer
+  {
+  public:
+    Timer(THREAD_ID tid, const void * key, const std::string & name, const char * category);
+    ~Timer();
+
+  private:
+    THREAD_ID _tid;
+    bool _active;
+  };
+
+  /// The accumulated timings of an object in one context
+  struct Entry
+  {
+    /// The chain of timers leading to this one, "category/name" joined by ';'
+    std::string _path;
+    std::string _name;
+    std::string _category;
+    Real _calls;
+    Real _inclusive;
+    Real _self;
+  };
+
+  /**
+   * Combine the timings of all threads and all processors of comm (the times are summed).
+   * This is collective on comm.  The entries are ordered by path.
+   */
+  void gather(const Parallel::Communicator & comm, std::vector<Entry> & entries) const;
+
+  /**
+   * Write the entries as a tree of {"name", "value", "children"} objects as used by flame graph
+   * viewers.  "value" is the inclusive time, "self" and "calls" are added to every node.
+   */
+  static void writeJSON(std::ostream & out, const std::vector<Entry> & entries);
+
+  /**
+   * Write the calls, self and inclusive time of every object (summed over the contexts it was
+   * called from) as CSV, most expensive (by self time) first
+   */
+  static void writeCSV(std::ostream & out, const std::vector<Entry> & entries);
+
+protected:
+  /// A timer in the tree of one thread
+  struct Node
+  {
+    Node(unsigned int parent, const std::string & name, const char * category);
+
+    unsigned int _parent;
+    std::string _name;
+    std::string _category;
+    std::map<const void *, unsigned int> _children;
+
+    unsigned long _calls;
+    Real _inclusive;
+    Real _children_time;
+
+    /// When the clock was read at the start of the current call, negative if this call is not sampled
+    Real _start;
+  };
+
+  /// The timers of one thread, the first node is the root
+  struct ThreadData
+  {
+    std::vector<Node> _nodes;
+    unsigned int _current;
+  };
+
+  /// Add the entries of one thread's tree below node_id to entries
+  void flatten(const ThreadData & data, unsigned int node_id, const std::string & path, std::map<std::string, Entry> & entries) const;
+
+  bool _enabled;
+
+  unsigned int _sampling_interval;
+
+  /// [thread]
+  std::vector<ThreadData> _threads;
+};
+
+#endif // OBJECTPROFILER_H
@@ -0,0 +1,88 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef QPINTERPOLATION_H
+#define QPINTERPOLATION_H
+
+// MOOSE includes
+#include "MooseArray.h"
+#include "MooseError.h"
+
+// System includes
+#include <vector>
+
+namespace QpInterpolation
+{
+
+/// The most coefficient vectors interpolate() accepts in one call
+const unsigned int max_sets = 4;
+
+/**
+ * Interpolates several sets of dof coefficients to the quadrature points at once:
+ *
+ *   (*out[s])[qp] = sum_i (*coeffs[s])[i] * phi[i][qp]
+ *
+ * i.e. one dense (n_sets x n_dofs) by (n_dofs x nqp) product.  T is Real, RealGradient or
+ * RealTensor, all of which are plain arrays of Real, so each shape function row is treated
+ * as one contiguous array of nqp * (number of components) values.  The inner loop is a
+ * branch-free axpy over that array which the compiler turns into SIMD instructions for
+ * whatever architecture we are built for, and each shape function row is loaded once for
+ * all of the coefficient sets.  The outputs are resized to nqp and overwritten.
+ */
+template <typename T>
+void
+interpolate(const MooseArray<std::vector<T> > & phi,
+            unsigned int n_dofs,
+            unsigned int nqp,
+            unsigned int n_sets,
+            const std::vector<Real> * const coeffs[],
+            MooseArray<T> * const out[])
+{
+  mooseAssert(n_sets <= max_sets, "Too many coefficient sets in QpInterpolation::interpolate()");
+  mooseAssert(sizeof(T) % sizeof(Real) == 0, "QpInterpolation::interpolate() needs T to be an array of Real");
+
+  const unsigned int n_components = sizeof(T) / sizeof(Real);
+  const unsigned int n = nqp * n_components;
+
+  Real * out_data[max_sets];
+  for (unsigned int s = 0; s < n_sets; ++s)
+  {
+    out[s]->resize(nqp);
+    out_data[s] = nqp ? reinterpret_cast<Real *>(&(*out[s])[0]) : NULL;
+
+    for (unsigned int k = 0; k < n; ++k)
+      out_data[s][k] = 0;
+  }
+
+  if (n == 0)
+    return;
+
+  for (unsigned int i = 0; i < n_dofs; ++i)
+  {
+    const Real * basis = reinterpret_cast<const Real *>(&phi[i][0]);
+
+    for (unsigned int s = 0; s < n_sets; ++s)
+    {
+      const Real c = (*coeffs[s])[i];
+      Real * result = out_data[s];
+
+      for (unsigned int k = 0; k < n; ++k)
+        result[k] += c * basis[k];
+    }
+  }
+}
+
+}
+
+#endif // QPINTERPOLATION_H
@@ -147,7 +147,8 @@ public:
 
   /**
    * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm)
-   * This routine assumes that C_ijkl = C_jikl = C_ijlk
+   * This routine assumes that C_ijkl = C_jikl = C_ijlk.  Callers that need the inverse
+   * repeatedly may keep a SymmetricRankFourTensor instead and skip the conversions.
    */
   RankFourTensor invSymm() const;
 
@@ -223,6 +224,12 @@ protected:
   /// Dimensionality of rank-four tensor
   static const unsigned int N = LIBMESH_DIM;
 
+  /// Number of entries of a rank-two tensor, the size of the 9x9 matrix view of the tensor used by the kernels
+  static const unsigned int N2 = N * N;
+
+  /// Number of entries of the tensor
+  static const unsigned int N4 = N2 * N2;
+
   /// The values of the rank-four tensor
   Real _vals[N][N][N][N];
 
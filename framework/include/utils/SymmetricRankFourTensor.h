@@ -0,0 +1,132 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "DerivativeMaterialInterface.h"
+
+// system includes
+#include <ostream>
+
+class RankTwoTensor;
+class RankFourTensor;
+class SymmetricRankFourTensor;
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template<>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor holds a fourth order tensor with the minor symmetries
+ * C_ijkl = C_jikl = C_ijlk, such as an elasticity tensor or its inverse, as a 6x6
+ * matrix in Mandel notation.
+ *
+ * The rows and columns are ordered 11, 22, 33, 23, 13, 12 and the shear rows and
+ * columns carry a factor of sqrt(2), so that M_ab = w_a * w_b * C_ijkl with
+ * w = (1, 1, 1, sqrt(2), sqrt(2), sqrt(2)).  With this scaling the double
+ * contraction C_ijpq * D_pqkl is the plain matrix product of the Mandel matrices,
+ * the inverse on the space of symmetric tensors is the plain matrix inverse and the
+ * L2 norm is the Frobenius norm, so all of the kernels below are short fixed-size
+ * loops over 36 contiguous entries instead of loops over 81 entries.
+ *
+ * Use the RankFourTensor constructor and toRankFourTensor() to convert between the
+ * two representations.  Converting a tensor without the minor symmetries keeps only
+ * its minor-symmetric part.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentitySymmetricFour
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensor(const InitMethod);
+
+  /// Convert from the full representation, averaging over the minor symmetries
+  explicit SymmetricRankFourTensor(const RankFourTensor & a);
+
+  /// Convert back to the full representation
+  RankFourTensor toRankFourTensor() const;
+
+  /// Gets the Mandel matrix entry for the index specified.  Takes index = 0,...,5
+  Real & operator()(unsigned int a, unsigned int b) { return _vals[a][b]; }
+
+  /// Gets the Mandel matrix entry for the index specified.  Takes index = 0,...,5
+  Real operator()(unsigned int a, unsigned int b) const { return _vals[a][b]; }
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the Mandel matrix
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// C_ijkl*a_kl, only the symmetric part of a contributes
+  RankTwoTensor operator* (const RankTwoTensor & a) const;
+
+  /// C_ijpq*a_pqkl
+  SymmetricRankFourTensor operator* (const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator* (const Real a) const;
+
+  /// C_ijkl += a_ijkl  for all i, j, k, l
+  SymmetricRankFourTensor & operator+= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+ (const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensor & operator-= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator- (const SymmetricRankFourTensor & a) const;
+
+  /// sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm)
+   * The Mandel matrix is inverted by Gauss-Jordan elimination with partial pivoting,
+   * a MooseException is thrown if it is singular.
+   */
+  SymmetricRankFourTensor invSymm() const;
+
+  /// The size of the Mandel matrix
+  static const unsigned int N = 6;
+
+protected:
+  /// The Mandel matrix
+  Real _vals[N][N];
+
+  template<class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template<class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template<>
+void dataStore(std::ostream &, SymmetricRankFourTensor &, void *);
+
+template<>
+void dataLoad(std::istream &, SymmetricRankFourTensor &, void *);
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b) { return b * a; }
+
+#endif //SYMMETRICRANKFOURTENSOR_H
@@ -50,6 +50,12 @@ protected:
    */
   const Elem * getLocalElemContainingPoint(const Point & p, unsigned int id);
 
+  /**
+   * Group the points by the local element that contains them, so that each element is
+   * reinitialized once with all of its points.
+   */
+  void findSampleElems();
+
   /// The Mesh we're using
   MooseMesh & _mesh;
 
@@ -67,10 +73,24 @@ protected:
 
   unsigned int _qp;
 
-  /// So we don't have to create and destroy this
-  std::vector<Point> _point_vec;
+  /// The names of the sampled variables
+  std::vector<std::string> _var_names;
 
   UniquePtr<PointLocatorBase> _pl;
+
+  /// Whether the elements containing the points can be kept while the mesh does not change
+  const bool _cache_sample_elems;
+
+  /// The local elements that contain any of the points
+  std::vector<const Elem *> _sample_elems;
+
+  /// The indices of the points in each of _sample_elems
+  std::vector<std::vector<unsigned int> > _sample_elem_points;
+
+  /// Whether _sample_elems has been built, and the points and mesh change count it was built for
+  bool _sample_elems_valid;
+  std::vector<Point> _sample_elems_points;
+  unsigned int _sample_elems_change_count;
 };
 
 #endif
@@ -96,6 +96,9 @@ protected:
   /// What to sort by
   unsigned int _sort_by;
 
+  /// Only gather the samples on processor 0
+  bool _gather_to_root;
+
   /// x coordinate of the points
   VectorPostprocessorValue & _x;
   /// y coordinate of the points
@@ -33,6 +33,9 @@ protected:
   void assembleDerivatives();
   MatPropDescriptorList::iterator findMatPropDerivative(const FunctionMaterialPropertyDescriptor &);
 
+  /// key under which the derivative w.r.t. the given arguments is stored in the function cache
+  std::string derivativeCacheKey(const std::vector<unsigned int> & dargs) const;
+
   struct QueueItem;
   struct Derivative;
 
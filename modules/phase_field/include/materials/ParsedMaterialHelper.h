@@ -55,6 +55,22 @@ protected:
   // run FPOptimizer on the parsed function
   virtual void functionsOptimize();
 
+  /// stage the (tolerance clipped) arguments and material properties of all qps in _func_params_batch
+  void fillParameterBatch();
+
+  /// evaluate a parser at every qp using the staged parameters and store the results in prop
+  void evaluateBatch(ADFunctionPtr & parser, MaterialProperty<Real> & prop);
+
+  /**
+   * Look up an optimized (and possibly JIT compiled) function object stored under key.
+   * Returns a deep copy that shares no data with other parser objects (and can be evaluated on
+   * any thread) or a NULL pointer if the key is unknown.
+   */
+  ADFunctionPtr findCachedFunction(const std::string & key) const;
+
+  /// store a copy of an optimized function object so other blocks and threads can skip the optimization and compilation
+  void cacheFunction(const std::string & key, const ADFunctionPtr & parser) const;
+
   /// The undiffed free energy function parser object.
   ADFunctionPtr _func_F;
 
@@ -70,6 +86,12 @@ protected:
   /// Tolerance values for all arguments (to protect from log(0)).
   std::vector<Real> _tol;
 
+  /// Function parameters for all quadrature points, one block of _func_params.size() values per qp
+  std::vector<Real> _func_params_batch;
+
+  /// Identifies the parsed function (expression, symbols, constants, and flags) in the function cache
+  std::string _function_cache_key;
+
   /**
    * Flag to indicate if MOOSE nonlinear variable names should be used as FParser variable names.
    * This should be true only for DerivativeParsedMaterial. If set to false, this class looks up the
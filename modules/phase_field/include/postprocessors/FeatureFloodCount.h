@@ -118,6 +118,13 @@ public:
 
     void expandBBox(const FeatureData & rhs);
 
+    /**
+     * Absorb rhs into this feature.  The entity sets are joined, the bounding boxes are expanded
+     * when the two features overlap physically (share ghosted entities) and kept separate when
+     * they only meet across a periodic boundary.  rhs is emptied and flagged as merged.
+     */
+    void merge(FeatureData & rhs);
+
     bool operator<(const FeatureData & rhs) const
     {
       return _min_entity_id < rhs._min_entity_id;
@@ -150,12 +157,16 @@ protected:
   /**
    * This method will "mark" all entities on neighboring elements that
    * are above the supplied threshold. If feature is NULL, we are exploring
-   * for a new region to mark, otherwise we are in the recursive calls
-   * currently marking a region.
+   * for a new region to mark, otherwise dof_object is added to that feature.
+   * The region is grown with an explicit stack (_flood_stack) rather than by
+   * recursion so that very large features can't overflow the call stack.
    */
   void flood(const DofObject * dof_object, int current_idx, FeatureData * feature);
 
-  // TODO: doco
+  /**
+   * Add the ghosted and halo entities around elem (or node) to feature.  When recurse is true the
+   * neighbors are also pushed onto _flood_stack so that flood() will visit them.
+   */
   void visitElementalNeighbors(const Elem * elem, int current_idx, FeatureData * feature, bool recurse);
   void visitNodalNeighbors(const Node * elem, int current_idx, FeatureData * feature, bool recurse);
 
@@ -183,7 +194,9 @@ protected:
 
   /**
    * This routine merges the data in _feature_sets from separate threads/processes to resolve
-   * any bubbles that were counted as unique by multiple processors.
+   * any bubbles that were counted as unique by multiple processors.  Partial features that share
+   * a ghosted entity (or a periodic node) are joined with a disjoint-set forest, so only
+   * features that actually touch are ever compared.
    */
   void mergeSets(bool use_periodic_boundary_info);
 
@@ -296,6 +309,9 @@ protected:
   /// The data structure used to find neighboring elements give a node ID
   std::vector< std::vector< const Elem * > > _nodes_to_elem_map;
 
+  /// The entities flood() still has to visit for the feature it is currently growing
+  std::vector<const DofObject *> _flood_stack;
+
   // The number of features seen by this object
   unsigned int _feature_count;
 
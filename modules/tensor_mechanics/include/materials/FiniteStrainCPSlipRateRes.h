@@ -92,6 +92,9 @@ protected:
   DenseVector<Real> _dsliprate_dgss;
   DenseMatrix<Real> _jacob;
   DenseMatrix<Real> _dsliprate_dsliprate;
+
+  ///Derivative of the PK2 stress with respect to each slip rate
+  std::vector<RankTwoTensor> _dpk2dsliprate;
 };
 
 #endif //FINITESTRAINCPSLIPRATERES_H
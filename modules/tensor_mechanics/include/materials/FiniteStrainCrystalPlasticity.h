@@ -27,6 +27,12 @@ public:
   FiniteStrainCrystalPlasticity(const InputParameters & parameters);
 
 protected:
+  /**
+   * This function computes the strain and then updates the stress at all quadrature points,
+   * in lockstep if batch_qps = true.
+   */
+  virtual void computeProperties();
+
   /**
    * This function updates the stress at a quadrature point.
    */
@@ -180,6 +186,57 @@ protected:
    */
   virtual void calcJacobian( RankFourTensor & );
 
+  /**
+   * This function calculates the elastic deformation gradient and the resolved shear stresses,
+   * the first part of calcResidual.
+   */
+  void calcResolvedShearStress();
+
+  /**
+   * This function calculates the stress residual from the slip increments,
+   * the second part of calcResidual.
+   */
+  void calcResidualFromSlipIncrements(RankTwoTensor & resid);
+
+  /**
+   * This function updates the stress at all quadrature points of the element in lockstep:
+   * every quadrature point takes its next Newton (or slip system resistance) iteration
+   * before any of them takes the one after, and quadrature points that converged or failed
+   * are masked out.  The state of each quadrature point is kept in the _batch workspaces,
+   * which are allocated once and reused for every element.  The arithmetic is the one of
+   * computeQpStress, so the results are bitwise identical.
+   * Only used without substepping and line search.
+   */
+  void computeBatchedStress();
+
+  /**
+   * This function solves the stress residual equation of the quadrature points in
+   * _batch_stress_active with NR, see solveStress.
+   */
+  void solveBatchedStress();
+
+  /**
+   * This function calculates the stress residual and jacobian of the quadrature points in qps.
+   */
+  void calcBatchedResidualJacobian(const std::vector<unsigned int> & qps);
+
+  /**
+   * This function updates the slip increments and their derivatives of the quadrature points
+   * in qps in one pass over the contiguous _batch arrays, see getSlipIncrements.
+   */
+  void getBatchedSlipIncrements(const std::vector<unsigned int> & qps);
+
+  /**
+   * This function repeats the update of every quadrature point with computeQpStress
+   * and stops if the results differ from the batched ones (batch_validation = true).
+   */
+  void validateBatchedStress();
+
+  ///Copies the state of a quadrature point from the _batch workspaces to the variables used by the per qp functions
+  void loadBatchState(unsigned int qp);
+  ///Copies the variables used by the per qp functions to the _batch workspaces of a quadrature point
+  void storeBatchState(unsigned int qp);
+
   /**
    * This function calculates rotation tensor from Euler angles.
    */
@@ -368,6 +425,35 @@ protected:
   Real _dfgrd_scale_factor;
   ///Flags to reset variables and reinitialize variables
   bool _first_step_iter, _last_step_iter, _first_substep;
+
+  ///Workspaces reused across iterations and qps instead of being allocated in every call
+  std::vector<Real> _gss_prev;
+  DenseVector<Real> _hb;
+  std::vector<RankTwoTensor> _dfpinvdslip;
+
+  ///Elasticity tensor rotated to the crystal orientation given by _crysrot_euler_angles
+  RankFourTensor _rotated_elasticity_tensor;
+  ///Euler angles _crysrot, _s0 and _rotated_elasticity_tensor were computed for
+  RealVectorValue _crysrot_euler_angles;
+  ///Whether _crysrot, _s0 and _rotated_elasticity_tensor have been computed yet
+  bool _crysrot_valid;
+
+  ///Flag to update all quadrature points of an element in lockstep
+  bool _batch_qps;
+  ///Flag to check the lockstep update against the per qp update
+  bool _batch_validation;
+
+  ///State of every quadrature point during the lockstep update, indexed by qp
+  std::vector<RankTwoTensor> _batch_dfgrd, _batch_pk2, _batch_fe, _batch_fp_old_inv, _batch_fp_inv, _batch_fp_prev_inv, _batch_resid;
+  std::vector<RankFourTensor> _batch_jac;
+  std::vector<Real> _batch_accslip, _batch_accslip_old, _batch_rnorm, _batch_rnorm0, _batch_gmax;
+  std::vector<unsigned int> _batch_iter, _batch_iterg;
+  ///Failure flag (_err_tol) of every quadrature point
+  std::vector<bool> _batch_failed;
+  ///Slip system values of every quadrature point, indexed by qp * _nss + slip system
+  std::vector<Real> _batch_gss, _batch_tau, _batch_slip_incr, _batch_dslipdtau;
+  ///Quadrature points still iterating on the slip system resistances and on the stress
+  std::vector<unsigned int> _batch_statevar_active, _batch_statevar_next, _batch_stress_active, _batch_stress_next;
 };
 
 #endif //FINITESTRAINCRYSTALPLASTICITY_H
@@ -0,0 +1,99 @@
+# Reports the time spent in the element Jacobian loop.  Run it with a range of
+# thread counts and both assembly types to compare their scaling, e.g.
+#
+#   moose_test-opt -i jacobian_assembly.i --n-threads=8 Mesh/nx=40 Mesh/ny=40 Mesh/nz=40 \
+#     Executioner/jacobian_assembly=colored Outputs/file_base=colored_8
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 8
+  ny = 8
+  nz = 8
+  elem_type = HEX8
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./u_left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./u_right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./v_left]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+  [./v_right]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Postprocessors]
+  [./jac_loop_calls]
+    type = PerformanceData
+    column = n_calls
+    event = element_jacobian_loop()
+  [../]
+  [./jac_loop_total_time]
+    type = PerformanceData
+    column = total_time
+    event = element_jacobian_loop()
+  [../]
+  [./jac_loop_average_time]
+    type = PerformanceData
+    column = average_time
+    event = element_jacobian_loop()
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  jacobian_assembly = locked
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
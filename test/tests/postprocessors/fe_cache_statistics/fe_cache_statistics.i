@@ -0,0 +1,71 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Problem]
+  fe_cache = true
+[]
+
+[Postprocessors]
+  [./hits]
+    type = FECacheStatistics
+    statistic = hits
+  [../]
+  [./misses]
+    type = FECacheStatistics
+    statistic = misses
+  [../]
+  [./hit_rate]
+    type = FECacheStatistics
+    statistic = hit_rate
+  [../]
+  [./entries]
+    type = FECacheStatistics
+    statistic = entries
+  [../]
+  [./memory]
+    type = FECacheStatistics
+    statistic = memory
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # A single Jacobian evaluation keeps the counters small
+  solve_type = 'LINEAR'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,82 @@
+# u lives everywhere, the second order v only on the left half.  On the right half
+# the SECOND LAGRANGE FE objects do not need to be reinitialized.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  elem_type = QUAD9
+[]
+
+[MeshModifiers]
+  [./left_domain]
+    type = SubdomainBoundingBox
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+    order = SECOND
+    block = 1
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+    block = 1
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./reinits]
+    type = FECacheStatistics
+    statistic = reinits
+  [../]
+  [./skipped_reinits]
+    type = FECacheStatistics
+    statistic = skipped_reinits
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # A single Jacobian evaluation keeps the counters small
+  solve_type = 'LINEAR'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,76 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./evaluations]
+    type = JacobianReuseStatistics
+    statistic = evaluations
+  [../]
+  [./reuses]
+    type = JacobianReuseStatistics
+    statistic = reuses
+  [../]
+  [./linear_rebuilds]
+    type = JacobianReuseStatistics
+    statistic = linear_rebuilds
+  [../]
+  [./contraction_rebuilds]
+    type = JacobianReuseStatistics
+    statistic = contraction_rebuilds
+  [../]
+  [./forced_rebuilds]
+    type = JacobianReuseStatistics
+    statistic = forced_rebuilds
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  reuse_jacobian = true
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,96 @@
+#
+# The problem of smp_single_test.i solved with solve_type = MATRIX_FREE and no [Preconditioning]
+# block.  The matrix-free operator applies the coupled Jacobian while the stored preconditioning
+# matrix only has the diagonal blocks.  With the exact Jacobian one Newton step solves this linear
+# problem, so the solve fails if the operator drops the off-diagonal block.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  nx = 10
+  ny = 10
+  elem_type = QUAD4
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./v]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  active = 'diff_u conv_u diff_v'
+
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./conv_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  active = 'left_u top_v bottom_v'
+
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 1
+  [../]
+
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 9
+  [../]
+
+  [./bottom_v]
+    type = DirichletBC
+    variable = v
+    boundary = 0
+    value = 5
+  [../]
+
+  [./top_v]
+    type = DirichletBC
+    variable = v
+    boundary = 2
+    value = 2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'MATRIX_FREE'
+
+  nl_max_its = 1
+  l_tol = 1e-10
+[]
+
+[Outputs]
+  file_base = smp_single_test_out
+  exodus = true
+[]
@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef CSRMAPTEST_H
+#define CSRMAPTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class CSRMapTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CSRMapTest );
+
+  CPPUNIT_TEST( buildTest );
+  CPPUNIT_TEST( emptyTest );
+  CPPUNIT_TEST( appendTest );
+  CPPUNIT_TEST( appendBeforeBuildTest );
+  CPPUNIT_TEST( sortAndRemoveDuplicatesTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void buildTest();
+  void emptyTest();
+  void appendTest();
+  void appendBeforeBuildTest();
+  void sortAndRemoveDuplicatesTest();
+};
+
+#endif  // CSRMAPTEST_H
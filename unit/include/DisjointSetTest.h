@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DISJOINTSETTEST_H
+#define DISJOINTSETTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class DisjointSetTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( DisjointSetTest );
+
+  CPPUNIT_TEST( mergeTest );
+  CPPUNIT_TEST( resizeTest );
+  CPPUNIT_TEST( randomTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void mergeTest();
+  void resizeTest();
+  void randomTest();
+};
+
+#endif  // DISJOINTSETTEST_H
@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef QPINTERPOLATIONTEST_H
+#define QPINTERPOLATIONTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class QpInterpolationTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( QpInterpolationTest );
+
+  CPPUNIT_TEST( valueTest );
+  CPPUNIT_TEST( gradientTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void valueTest();
+  void gradientTest();
+};
+
+#endif  // QPINTERPOLATIONTEST_H
@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SYMMETRICRANKFOURTENSORTEST_H
+#define SYMMETRICRANKFOURTENSORTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "RankFourTensor.h"
+
+class SymmetricRankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( SymmetricRankFourTensorTest );
+
+  CPPUNIT_TEST( conversionTest );
+  CPPUNIT_TEST( contractionTest );
+  CPPUNIT_TEST( productTest );
+  CPPUNIT_TEST( invSymmTest );
+  CPPUNIT_TEST( singularTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  SymmetricRankFourTensorTest();
+  ~SymmetricRankFourTensorTest();
+
+  void conversionTest();
+  void contractionTest();
+  void productTest();
+  void invSymmTest();
+  void singularTest();
+
+ private:
+  RankFourTensor _iSymmetric;
+
+  /// An anisotropic elasticity tensor with all 21 independent components filled in
+  RankFourTensor _anisotropic;
+};
+
+#endif  // SYMMETRICRANKFOURTENSORTEST_H